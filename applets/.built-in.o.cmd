@@ -0,0 +1 @@
+cmd_applets/built-in.o :=  gcc -nostdlib -nostdlib  -r -o applets/built-in.o applets/applets.o
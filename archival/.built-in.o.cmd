@@ -0,0 +1 @@
+cmd_archival/built-in.o :=  rm -f archival/built-in.o; ar rcs archival/built-in.o
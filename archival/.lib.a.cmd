@@ -0,0 +1 @@
+cmd_archival/lib.a := rm -f archival/lib.a; ar  rcs archival/lib.a archival/bbunzip.o archival/bzip2.o archival/chksum_and_xwrite_tar_header.o archival/cpio.o archival/dpkg.o archival/dpkg_deb.o archival/gzip.o archival/lzop.o archival/rpm.o archival/tar.o archival/unzip.o
@@ -0,0 +1 @@
+cmd_archival/libarchive/built-in.o :=  rm -f archival/libarchive/built-in.o; ar rcs archival/libarchive/built-in.o
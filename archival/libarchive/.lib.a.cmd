@@ -0,0 +1 @@
+cmd_archival/libarchive/lib.a := rm -f archival/libarchive/lib.a; ar  rcs archival/libarchive/lib.a archival/libarchive/common.o archival/libarchive/data_align.o archival/libarchive/data_extract_all.o archival/libarchive/data_extract_to_command.o archival/libarchive/data_extract_to_stdout.o archival/libarchive/data_skip.o archival/libarchive/decompress_bunzip2.o archival/libarchive/decompress_gunzip.o archival/libarchive/decompress_unlzma.o archival/libarchive/decompress_unxz.o archival/libarchive/filter_accept_all.o archival/libarchive/filter_accept_list.o archival/libarchive/filter_accept_list_reassign.o archival/libarchive/filter_accept_reject_list.o archival/libarchive/find_list_entry.o archival/libarchive/get_header_ar.o archival/libarchive/get_header_cpio.o archival/libarchive/get_header_tar.o archival/libarchive/get_header_tar_bz2.o archival/libarchive/get_header_tar_gz.o archival/libarchive/get_header_tar_lzma.o archival/libarchive/get_header_tar_xz.o archival/libarchive/header_list.o archival/libarchive/header_skip.o archival/libarchive/header_verbose_list.o archival/libarchive/init_handle.o archival/libarchive/lzo1x_1.o archival/libarchive/lzo1x_1o.o archival/libarchive/lzo1x_d.o archival/libarchive/open_transformer.o archival/libarchive/seek_by_jump.o archival/libarchive/seek_by_read.o archival/libarchive/unpack_ar_archive.o archival/libarchive/unsafe_prefix.o archival/libarchive/unsafe_symlink_target.o
@@ -0,0 +1 @@
+cmd_console-tools/built-in.o :=  rm -f console-tools/built-in.o; ar rcs console-tools/built-in.o
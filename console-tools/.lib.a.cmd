@@ -0,0 +1 @@
+cmd_console-tools/lib.a := rm -f console-tools/lib.a; ar  rcs console-tools/lib.a console-tools/chvt.o console-tools/clear.o console-tools/deallocvt.o console-tools/dumpkmap.o console-tools/fgconsole.o console-tools/kbd_mode.o console-tools/loadfont.o console-tools/loadkmap.o console-tools/openvt.o console-tools/reset.o console-tools/resize.o console-tools/setconsole.o console-tools/setkeycodes.o console-tools/setlogcons.o console-tools/showkey.o
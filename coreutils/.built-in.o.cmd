@@ -0,0 +1 @@
+cmd_coreutils/built-in.o :=  rm -f coreutils/built-in.o; ar rcs coreutils/built-in.o
@@ -0,0 +1 @@
+cmd_coreutils/lib.a := rm -f coreutils/lib.a; ar  rcs coreutils/lib.a coreutils/basename.o coreutils/cat.o coreutils/chgrp.o coreutils/chmod.o coreutils/chown.o coreutils/chroot.o coreutils/cksum.o coreutils/comm.o coreutils/cp.o coreutils/cut.o coreutils/date.o coreutils/dd.o coreutils/df.o coreutils/dirname.o coreutils/dos2unix.o coreutils/du.o coreutils/echo.o coreutils/env.o coreutils/expand.o coreutils/expr.o coreutils/factor.o coreutils/false.o coreutils/fold.o coreutils/head.o coreutils/hostid.o coreutils/id.o coreutils/install.o coreutils/link.o coreutils/ln.o coreutils/logname.o coreutils/ls.o coreutils/md5_sha1_sum.o coreutils/mkdir.o coreutils/mkfifo.o coreutils/mknod.o coreutils/mktemp.o coreutils/mv.o coreutils/nice.o coreutils/nl.o coreutils/nohup.o coreutils/nproc.o coreutils/od.o coreutils/paste.o coreutils/printenv.o coreutils/printf.o coreutils/pwd.o coreutils/readlink.o coreutils/realpath.o coreutils/rm.o coreutils/rmdir.o coreutils/seq.o coreutils/shred.o coreutils/shuf.o coreutils/sleep.o coreutils/sort.o coreutils/split.o coreutils/stat.o coreutils/stty.o coreutils/sum.o coreutils/sync.o coreutils/tac.o coreutils/tail.o coreutils/tee.o coreutils/test.o coreutils/test_ptr_hack.o coreutils/timeout.o coreutils/touch.o coreutils/tr.o coreutils/true.o coreutils/truncate.o coreutils/tsort.o coreutils/tty.o coreutils/uname.o coreutils/uniq.o coreutils/unlink.o coreutils/usleep.o coreutils/uudecode.o coreutils/uuencode.o coreutils/wc.o coreutils/who.o coreutils/whoami.o coreutils/yes.o
@@ -88,34 +88,65 @@ static int cmpfunc(const void *a, const void *b)
 static void cut_file(FILE *file, const char *delim, const char *odelim,
 		const struct cut_list *cut_lists, unsigned nlists)
 {
-	char *line;
+	char *line = NULL;
+	size_t line_alloc = 0;
+	char *printed = NULL;
+	size_t printed_alloc = 0;
+	ssize_t len;
 	unsigned linenum = 0;	/* keep these zero-based to be consistent */
 	regex_t reg;
 	int spos, shoe = option_mask32 & CUT_OPT_REGEX_FLGS;
 
 	if (shoe) xregcomp(&reg, delim, REG_EXTENDED);
 
-	/* go through every line in the file */
-	while ((line = xmalloc_fgetline(file)) != NULL) {
-
-		/* set up a list so we can keep track of what's been printed */
-		int linelen = strlen(line);
-		char *printed = xzalloc(linelen + 1);
-		char *orig_line = line;
+	/* go through every line in the file.
+	 * getline() splits stdio's buffer with memchr, and the line
+	 * buffer is reused: no per-line allocations */
+	while ((len = getline(&line, &line_alloc, file)) >= 0) {
+		int linelen = len;
 		unsigned cl_pos = 0;
 
+		if (linelen && line[linelen - 1] == '\n')
+			line[--linelen] = '\0';
+
 		/* cut based on chars/bytes XXX: only works when sizeof(char) == byte */
 		if (option_mask32 & (CUT_OPT_CHAR_FLGS | CUT_OPT_BYTE_FLGS)) {
+			/* set up a list so we can keep track of what's been printed */
+			if (nlists > 1) {
+				if (printed_alloc <= (size_t)linelen) {
+					printed_alloc = linelen + 1;
+					free(printed);
+					printed = xmalloc(printed_alloc);
+				}
+				memset(printed, 0, linelen + 1);
+			}
 			/* print the chars specified in each cut list */
 			for (; cl_pos < nlists; cl_pos++) {
-				for (spos = cut_lists[cl_pos].startpos; spos < linelen;) {
-					if (!printed[spos]) {
-						printed[spos] = 'X';
-						putchar(line[spos]);
-					}
-					if (++spos > cut_lists[cl_pos].endpos) {
-						break;
+				int epos = linelen;
+
+				if (cut_lists[cl_pos].endpos < linelen)
+					epos = cut_lists[cl_pos].endpos + 1;
+				spos = cut_lists[cl_pos].startpos;
+				if (!printed) {
+					/* a single list can't overlap itself */
+					if (spos < epos)
+						fwrite(line + spos, 1, epos - spos, stdout);
+					continue;
+				}
+				/* write out runs of not yet printed chars */
+				while (spos < epos) {
+					char *p;
+					int run;
+
+					if (printed[spos]) {
+						spos++;
+						continue;
 					}
+					p = memchr(printed + spos, 'X', epos - spos);
+					run = (p ? p - printed : epos) - spos;
+					memset(printed + spos, 'X', run);
+					fwrite(line + spos, 1, run, stdout);
+					spos += run;
 				}
 			}
 		} else if (*delim == '\n') {	/* cut by lines */
@@ -182,8 +213,15 @@ static void cut_file(FILE *file, const char *delim, const char *odelim,
 							uu = linelen;
 							continue;
 						}
-					} else if (line[end = uu++] != *delim)
-						continue;
+					} else {
+						char *d = memchr(line + uu, *delim, linelen - uu);
+						if (!d) {
+							uu = linelen;
+							continue;
+						}
+						end = d - line;
+						uu = end + 1;
+					}
 
 					/* Got delimiter. Loop if not yet within range. */
 					if (dcount++ < cut_lists[cl_pos].startpos) {
@@ -191,8 +229,11 @@ static void cut_file(FILE *file, const char *delim, const char *odelim,
 						continue;
 					}
 				}
-				if (end != start || !shoe)
-					printf("%s%.*s", out++ ? odelim : "", end-start, line + start);
+				if (end != start || !shoe) {
+					if (out++)
+						fputs(odelim, stdout);
+					fwrite(line + start, 1, end - start, stdout);
+				}
 				start = uu;
 				if (!dcount)
 					break;
@@ -202,8 +243,10 @@ static void cut_file(FILE *file, const char *delim, const char *odelim,
 		putchar('\n');
  next_line:
 		linenum++;
+	}
+	if (ENABLE_FEATURE_CLEAN_UP) {
 		free(printed);
-		free(orig_line);
+		free(line);
 	}
 }
 
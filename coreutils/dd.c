@@ -50,6 +50,16 @@
 //config:	depends on DD
 //config:	help
 //config:	Enable support for status=noxfer/none option.
+//config:
+//config:config FEATURE_DD_QUEUE
+//config:	bool "Enable qd=N option (read ahead in a second process)"
+//config:	default y
+//config:	depends on DD && !NOMMU
+//config:	help
+//config:	With qd=N, a second process reads up to N blocks ahead
+//config:	of the writes, so that the input and output devices
+//config:	work at the same time. Most useful with iflag=direct
+//config:	and oflag=direct, or when input comes over the network.
 
 //applet:IF_DD(APPLET_NOEXEC(dd, dd, BB_DIR_BIN, BB_SUID_DROP, dd))
 
@@ -57,6 +67,7 @@
 
 //usage:#define dd_trivial_usage
 //usage:       "[if=FILE] [of=FILE] [" IF_FEATURE_DD_IBS_OBS("ibs=N obs=N/") "bs=N] [count=N] [skip=N] [seek=N]"
+//usage:	IF_FEATURE_DD_QUEUE(" [qd=N]")
 //usage:	IF_FEATURE_DD_IBS_OBS("\n"
 //usage:       "	[conv=notrunc|noerror|sync|fsync]\n"
 //usage:       "	[iflag=skip_bytes|count_bytes|fullblock|direct] [oflag=seek_bytes|append|direct]"
@@ -75,6 +86,9 @@
 //usage:     "\n	count=N		Copy only N input blocks"
 //usage:     "\n	skip=N		Skip N input blocks"
 //usage:     "\n	seek=N		Skip N output blocks"
+//usage:	IF_FEATURE_DD_QUEUE(
+//usage:     "\n	qd=N		Read up to N blocks ahead of writing"
+//usage:	)
 //usage:	IF_FEATURE_DD_IBS_OBS(
 //usage:     "\n	conv=notrunc	Don't truncate output file"
 //usage:     "\n	conv=noerror	Continue after read errors"
@@ -119,8 +133,23 @@ struct globals {
 	unsigned long long begin_time_us;
 #endif
 	int flags;
+#if ENABLE_FEATURE_DD_QUEUE
+	/* qd=N: reader process fills a ring of N blocks */
+	unsigned qd;
+	smallint q_busy; /* we hold q_slot */
+	unsigned q_slot;
+	size_t slot_size;
+	char *ring;
+	int msg_fd, credit_fd;
+	pid_t reader_pid;
+#endif
 } FIX_ALIASING;
 #define G (*(struct globals*)bb_common_bufsiz1)
+#if ENABLE_FEATURE_DD_QUEUE
+# define reading_ahead() (G.reader_pid != 0)
+#else
+# define reading_ahead() 0
+#endif
 #define INIT_G() do { \
 	setup_common_bufsiz(); \
 	/* we have to zero it out because of NOEXEC */ \
@@ -235,6 +264,114 @@ static ssize_t dd_read(void *ibuf, size_t ibs)
 	return n;
 }
 
+#if ENABLE_FEATURE_DD_QUEUE
+/* The reader tells about every block it puts into the ring with one of these.
+ * The slots are used in order; when all of them are full, the reader waits
+ * for a byte on the credit pipe, which we send when we are done with a slot.
+ */
+struct dd_msg {
+	ssize_t n;
+	int err;
+};
+
+static void NORETURN dd_reader(size_t ibs, off_t count, int msg_fd, int credit_fd)
+{
+	unsigned slot = 0;
+	unsigned free_slots = G.qd;
+
+	signal(SIGUSR1, SIG_IGN);
+	close(ofd);
+	for (;;) {
+		struct dd_msg m;
+		ssize_t n = ibs;
+
+		/* Same count logic as in the main loop */
+		if (G.flags & FLAG_COUNT) {
+			if (count == 0)
+				break;
+			if ((G.flags & FLAG_COUNT_BYTES) && count < ibs)
+				n = count;
+		}
+		if (free_slots == 0) {
+			char c;
+			if (safe_read(credit_fd, &c, 1) != 1)
+				break; /* parent is gone */
+			free_slots++;
+		}
+		n = dd_read(G.ring + slot * G.slot_size, n);
+		m.n = n;
+		m.err = errno;
+		if (n < 0) {
+			if (!(G.flags & FLAG_NOERROR)) {
+				full_write(msg_fd, &m, sizeof(m));
+				break;
+			}
+			xlseek(ifd, ibs, SEEK_CUR);
+			n = 0;
+		}
+		full_write(msg_fd, &m, sizeof(m));
+		if (m.n == 0)
+			break;
+		count -= (G.flags & FLAG_COUNT_BYTES) ? n : 1;
+		free_slots--;
+		if (++slot == G.qd)
+			slot = 0;
+	}
+	_exit(EXIT_SUCCESS);
+}
+
+static void dd_start_reader(size_t ibs, off_t count)
+{
+	struct fd_pair msg, credit;
+	size_t pagesz = bb_getpagesize();
+
+	/* Slots are page aligned for {i,o}flag=direct */
+	G.slot_size = (ibs + pagesz - 1) & ~(pagesz - 1);
+	if (G.slot_size > ((size_t)-1) / G.qd)
+		bb_die_memory_exhausted();
+	G.ring = mmap(NULL, G.slot_size * G.qd,
+			PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS,
+			/* ignored: */ -1, 0);
+	if (G.ring == MAP_FAILED)
+		bb_die_memory_exhausted();
+
+	xpiped_pair(msg);
+	xpiped_pair(credit);
+	G.reader_pid = xfork();
+	if (G.reader_pid == 0) {
+		close(msg.rd);
+		close(credit.wr);
+		dd_reader(ibs, count, msg.wr, credit.rd);
+	}
+	close(msg.wr);
+	/* credit.rd stays open: sending credits after the reader
+	 * has exited must not get us SIGPIPE */
+	G.msg_fd = msg.rd;
+	G.credit_fd = credit.wr;
+}
+
+/* dd_read() replacement: returns the next block the reader has read */
+static ssize_t dd_queue_get(char **bufp)
+{
+	struct dd_msg m;
+
+	if (G.q_busy) {
+		/* Previous block is written, its slot can be reused */
+		xwrite(G.credit_fd, "", 1);
+		if (++G.q_slot == G.qd)
+			G.q_slot = 0;
+	}
+	G.q_busy = 1;
+	/* Short read: reader died (and said why) */
+	if (full_read(G.msg_fd, &m, sizeof(m)) != sizeof(m))
+		xfunc_die();
+	*bufp = G.ring + G.q_slot * G.slot_size;
+	errno = m.err;
+	return m.n;
+}
+#endif
+
 static bool write_and_stats(const void *buf, size_t len, size_t obs,
 	const char *filename)
 {
@@ -318,6 +455,7 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 {
 	static const char keywords[] ALIGN1 =
 		"bs\0""count\0""seek\0""skip\0""if\0""of\0"IF_FEATURE_DD_STATUS("status\0")
+		IF_FEATURE_DD_QUEUE("qd\0")
 #if ENABLE_FEATURE_DD_IBS_OBS
 		"ibs\0""obs\0""conv\0""iflag\0""oflag\0"
 #endif
@@ -342,6 +480,7 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 		OP_if,
 		OP_of,
 		IF_FEATURE_DD_STATUS(OP_status,)
+		IF_FEATURE_DD_QUEUE(OP_qd,)
 #if ENABLE_FEATURE_DD_IBS_OBS
 		OP_ibs,
 		OP_obs,
@@ -485,6 +624,13 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 			G.flags |= FLAG_STATUS_NONE << n;
 			/*continue;*/
 		}
+#endif
+#if ENABLE_FEATURE_DD_QUEUE
+		if (what == OP_qd) {
+			/* All messages and credits must fit into the pipes */
+			G.qd = xatou_range(val, 1, 1024);
+			/*continue;*/
+		}
 #endif
 	} /* end of "for (argv[i])" */
 
@@ -571,6 +717,12 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 			goto die_outfile;
 	}
 
+#if ENABLE_FEATURE_DD_QUEUE
+	/* With one slot, reader would wait for every write anyway */
+	if (G.qd > 1)
+		dd_start_reader(ibs, count);
+#endif
+
 	while (1) {
 		ssize_t n = ibs;
 
@@ -581,7 +733,12 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 				n = count;
 		}
 
-		n = dd_read(ibuf, n);
+#if ENABLE_FEATURE_DD_QUEUE
+		if (reading_ahead())
+			n = dd_queue_get(&ibuf);
+		else
+#endif
+			n = dd_read(ibuf, n);
 		if (n == 0)
 			break;
 		if (n < 0) {
@@ -590,7 +747,9 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 				goto die_infile;
 			bb_simple_perror_msg(infile);
 			/* GNU dd with conv=noerror skips over bad blocks */
-			xlseek(ifd, ibs, SEEK_CUR);
+			/* (reader process does it itself) */
+			if (!reading_ahead())
+				xlseek(ifd, ibs, SEEK_CUR);
 			/* conv=noerror,sync writes NULs,
 			 * conv=noerror just ignores input bad blocks */
 			n = 0;
@@ -674,6 +833,13 @@ int dd_main(int argc UNUSED_PARAM, char **argv)
 
 	exitcode = EXIT_SUCCESS;
  out_status:
+#if ENABLE_FEATURE_DD_QUEUE
+	if (reading_ahead()) {
+		/* After a write error, it may be still reading */
+		kill(G.reader_pid, SIGKILL);
+		safe_waitpid(G.reader_pid, NULL, 0);
+	}
+#endif
 	if (!ENABLE_FEATURE_DD_STATUS || !(G.flags & FLAG_STATUS_NONE))
 		dd_output_status(0);
 
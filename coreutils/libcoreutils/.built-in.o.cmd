@@ -0,0 +1 @@
+cmd_coreutils/libcoreutils/built-in.o :=  rm -f coreutils/libcoreutils/built-in.o; ar rcs coreutils/libcoreutils/built-in.o
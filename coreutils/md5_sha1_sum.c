@@ -151,13 +151,12 @@ static unsigned char *hash_bin_to_hex(unsigned char *hash_value,
 	return (unsigned char *)hex_value;
 }
 
-#define BUFSZ (CONFIG_FEATURE_COPYBUF_KB < 4 ? 4096 : CONFIG_FEATURE_COPYBUF_KB * 1024)
-
 #if !ENABLE_SHA3SUM
 # define hash_file(b,f,w) hash_file(b,f)
 #endif
 static uint8_t *hash_file(unsigned char *in_buf, const char *filename, unsigned sha3_width)
 {
+	bulk_reader_t br;
 	int src_fd, hash_len, count;
 	union _ctx_ {
 		sha3_ctx_t sha3;
@@ -229,7 +228,8 @@ static uint8_t *hash_file(unsigned char *in_buf, const char *filename, unsigned
 	}
 
 	{
-		while ((count = safe_read(src_fd, in_buf, BUFSZ)) > 0) {
+		bulk_reader_init(&br, src_fd);
+		while ((count = bulk_read(&br, in_buf, BULK_READ_SIZE)) > 0) {
 			update(&context, in_buf, count);
 		}
 		hash_value = NULL;
@@ -281,10 +281,10 @@ int md5_sha1_sum_main(int argc UNUSED_PARAM, char **argv)
 		*--argv = (char*)"-";
 
 	/* The buffer is not alloc/freed for each input file:
-	 * for big values of COPYBUF_KB, this helps to keep its pages
-	 * pre-faulted and possibly even fully cached on local CPU.
+	 * this helps to keep its pages pre-faulted
+	 * and possibly even fully cached on local CPU.
 	 */
-	in_buf = xmalloc(BUFSZ);
+	in_buf = xmalloc_bulk_buf();
 
 	do {
 		if (ENABLE_FEATURE_MD5_SHA1_SUM_CHECK && (flags & FLAG_CHECK)) {
@@ -287,57 +287,119 @@ lcm(unsigned u, unsigned v) {
 	return u * v / t;
 }
 
+/* Integers are formatted by hand: printf() per value is most of the time
+ * od spends. fmt_string is one of the doux_fmtstring[] formats,
+ * " %[0]WIDTH[ll]{d,o,u,x}", and WIDTH always fits the widest value.
+ */
 static void
-print_s_char(size_t n_bytes, const char *block, const char *fmt_string)
+print_integers(size_t n_bytes, const char *block, const char *fmt_string, unsigned size)
 {
+	char buf[256];
+	char *out = buf;
+	const char *fmt = fmt_string + 2;
+	char pad = ' ';
+	unsigned width = 0;
+	unsigned base;
+	char conv;
+
+	if (*fmt == '0') {
+		pad = '0';
+		fmt++;
+	}
+	while (isdigit(*fmt))
+		width = width * 10 + (*fmt++ - '0');
+	while (*fmt == 'l')
+		fmt++;
+	conv = *fmt;
+	base = (conv == 'o') ? 8 : (conv == 'x') ? 16 : 10;
+
+	n_bytes /= size;
 	while (n_bytes--) {
-		int tmp = *(signed char *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned char);
+		ulonglong_t v;
+		char *q;
+		smallint neg = 0;
+
+		switch (size) {
+		case 1:
+			v = *(unsigned char *) block;
+			if (conv == 'd')
+				v = (signed char) v;
+			break;
+		case 2:
+			v = *(unsigned short *) block;
+			if (conv == 'd')
+				v = (signed short) v;
+			break;
+		case 4:
+			v = *(uint32_t *) block;
+			if (conv == 'd')
+				v = (int32_t) v;
+			break;
+		default:
+			v = *(ulonglong_t *) block;
+			break;
+		}
+		block += size;
+		if (conv == 'd' && (long long) v < 0) {
+			neg = 1;
+			v = -v;
+		}
+
+		if (out + 1 + width > buf + sizeof(buf)) {
+			fwrite(buf, 1, out - buf, stdout);
+			out = buf;
+		}
+		*out++ = ' ';
+		out += width;
+		q = out;
+		if (base == 10) {
+			do {
+				*--q = '0' + v % 10;
+				v /= 10;
+			} while (v);
+		} else {
+			unsigned shift = (base == 16) ? 4 : 3;
+			do {
+				*--q = bb_hexdigits_upcase[v & (base - 1)] | 0x20;
+				v >>= shift;
+			} while (v);
+		}
+		if (neg)
+			*--q = '-';
+		while (q != out - width)
+			*--q = pad;
 	}
+	fwrite(buf, 1, out - buf, stdout);
+}
+
+static void
+print_s_char(size_t n_bytes, const char *block, const char *fmt_string)
+{
+	print_integers(n_bytes, block, fmt_string, sizeof(signed char));
 }
 
 static void
 print_char(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	while (n_bytes--) {
-		unsigned tmp = *(unsigned char *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned char);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(unsigned char));
 }
 
 static void
 print_s_short(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	n_bytes /= sizeof(signed short);
-	while (n_bytes--) {
-		int tmp = *(signed short *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned short);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(signed short));
 }
 
 static void
 print_short(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	n_bytes /= sizeof(unsigned short);
-	while (n_bytes--) {
-		unsigned tmp = *(unsigned short *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned short);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(unsigned short));
 }
 
 static void
 print_int(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	n_bytes /= sizeof(unsigned);
-	while (n_bytes--) {
-		unsigned tmp = *(unsigned *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(unsigned));
 }
 
 #if UINT_MAX == ULONG_MAX
@@ -346,12 +408,7 @@ print_int(size_t n_bytes, const char *block, const char *fmt_string)
 static void
 print_long(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	n_bytes /= sizeof(unsigned long);
-	while (n_bytes--) {
-		unsigned long tmp = *(unsigned long *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(unsigned long);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(unsigned long));
 }
 #endif
 
@@ -361,12 +418,7 @@ print_long(size_t n_bytes, const char *block, const char *fmt_string)
 static void
 print_long_long(size_t n_bytes, const char *block, const char *fmt_string)
 {
-	n_bytes /= sizeof(ulonglong_t);
-	while (n_bytes--) {
-		ulonglong_t tmp = *(ulonglong_t *) block;
-		printf(fmt_string, tmp);
-		block += sizeof(ulonglong_t);
-	}
+	print_integers(n_bytes, block, fmt_string, sizeof(ulonglong_t));
 }
 #endif
 
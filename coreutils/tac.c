@@ -31,18 +31,127 @@
 
 /* This is a NOEXEC applet. Be very careful! */
 
-struct lstring {
-	int size;
-	char buf[1];
+#define TAC_BLKSZ (64 * 1024)
+
+struct tac {
+	/* Input: data of the file read so far, at the end of buf,
+	 * minus the lines already written out */
+	char *buf;
+	size_t cap;
+	/* Output is collected here, not written line by line */
+	char *out;
+	size_t outlen;
 };
 
+static void tac_write(struct tac *t, const char *s, size_t n)
+{
+	if (t->outlen + n > TAC_BLKSZ) {
+		xwrite(STDOUT_FILENO, t->out, t->outlen);
+		t->outlen = 0;
+		if (n > TAC_BLKSZ) {
+			xwrite(STDOUT_FILENO, s, n);
+			return;
+		}
+	}
+	memcpy(t->out + t->outlen, s, n);
+	t->outlen += n;
+}
+
+/* Write out, last to first, the lines of buf[start..end) which
+ * begin after a '\n' found in buf[start..top). The first line
+ * is written too if it's the start of file. Returns the new end.
+ */
+static size_t tac_lines(struct tac *t, size_t start, size_t top, size_t end, int at_bof)
+{
+	char *nl;
+
+	while ((nl = memrchr(t->buf + start, '\n', top - start)) != NULL) {
+		top = nl - t->buf;
+		tac_write(t, nl + 1, end - (top + 1));
+		end = top + 1;
+	}
+	if (at_bof) {
+		tac_write(t, t->buf + start, end - start);
+		end = start;
+	}
+	return end;
+}
+
+/* Regular files are read backwards from EOF, a block at a time:
+ * memory use is the block size or the longest line, whichever is bigger.
+ * Other input is read whole first.
+ */
+static int tac_fd(struct tac *t, int fd)
+{
+	struct stat st;
+	off_t base, off;
+	size_t start, end;
+
+	base = lseek(fd, 0, SEEK_CUR);
+	if (base < 0 || fstat(fd, &st) != 0
+	 || !S_ISREG(st.st_mode)
+	 || st.st_size == 0 /* /proc files */
+	) {
+		char *buf;
+		size_t len = (size_t)-1;
+
+		buf = xmalloc_read(fd, &len);
+		if (!buf)
+			return -1;
+		free(t->buf);
+		t->buf = buf;
+		t->cap = len;
+		tac_lines(t, 0, len ? len - 1 : 0, len, 1);
+		return 0;
+	}
+
+	off = st.st_size;
+	start = end = t->cap;
+	while (off > base) {
+		size_t partial = end - start;
+		size_t n = TAC_BLKSZ;
+		size_t top;
+
+		if ((off_t)n > off - base)
+			n = off - base;
+		if (start < n) {
+			/* Move the partial line to the end of buf to make
+			 * room before it. Grow buf if it is more than half
+			 * full, so that long lines don't get moved over and over.
+			 */
+			if (partial + n > t->cap / 2) {
+				size_t cap = (partial + n) * 2;
+				char *buf = xmalloc(cap);
+				memcpy(buf + cap - partial, t->buf + start, partial);
+				free(t->buf);
+				t->buf = buf;
+				t->cap = cap;
+			} else {
+				memmove(t->buf + t->cap - partial, t->buf + start, partial);
+			}
+			end = t->cap;
+			start = end - partial;
+		}
+		/* the last byte may be the '\n' which ends the next line:
+		 * don't look at it, nor at the partial line, which has no '\n' */
+		top = start < end - 1 ? start : end - 1;
+		start -= n;
+		off -= n;
+		if (pread(fd, t->buf + start, n, off) != (ssize_t)n) {
+			/* short read: file was truncated under us? */
+			if (errno == 0)
+				errno = EIO;
+			return -1;
+		}
+		end = tac_lines(t, start, top, end, off == base);
+	}
+	return 0;
+}
+
 int tac_main(int argc, char **argv) MAIN_EXTERNALLY_VISIBLE;
 int tac_main(int argc UNUSED_PARAM, char **argv)
 {
-	char **name;
-	FILE *f;
-	struct lstring *line = NULL;
-	llist_t *list = NULL;
+	struct tac t;
 	int retval = EXIT_SUCCESS;
 
 #if ENABLE_DESKTOP
@@ -62,55 +171,28 @@ We support none, but at least we will complain or handle "--":
 #endif
 	if (!*argv)
 		*--argv = (char *)"-";
-	/* We will read from last file to first */
-	name = argv;
-	while (*name)
-		name++;
 
+	memset(&t, 0, sizeof(t));
+	t.out = xmalloc(TAC_BLKSZ);
 	do {
-		int ch, i;
-
-		name--;
-		f = fopen_or_warn_stdin(*name);
-		if (f == NULL) {
-			/* error message is printed by fopen_or_warn_stdin */
+		int fd = open_or_warn_stdin(*argv);
+		if (fd < 0) {
 			retval = EXIT_FAILURE;
 			continue;
 		}
-
-		errno = i = 0;
-		do {
-			ch = fgetc(f);
-			if (ch != EOF) {
-				if (!(i & 0x7f))
-					/* Grow on every 128th char */
-					line = xrealloc(line, i + 0x7f + sizeof(int) + 1);
-				line->buf[i++] = ch;
-			}
-			if (ch == '\n' || (ch == EOF && i != 0)) {
-				line = xrealloc(line, i + sizeof(int));
-				line->size = i;
-				llist_add_to(&list, line);
-				line = NULL;
-				i = 0;
-			}
-		} while (ch != EOF);
-		/* fgetc sets errno to ENOENT on EOF, we don't want
-		 * to warn on this non-error! */
-		if (errno && errno != ENOENT) {
-			bb_simple_perror_msg(*name);
+		errno = 0;
+		if (tac_fd(&t, fd) != 0) {
+			bb_simple_perror_msg(*argv);
 			retval = EXIT_FAILURE;
 		}
-	} while (name != argv);
-
-	while (list) {
-		line = (struct lstring *)list->data;
-		xwrite(STDOUT_FILENO, line->buf, line->size);
-		if (ENABLE_FEATURE_CLEAN_UP) {
-			free(llist_pop(&list));
-		} else {
-			list = list->link;
-		}
+		if (fd != STDIN_FILENO)
+			close(fd);
+	} while (*++argv);
+	xwrite(STDOUT_FILENO, t.out, t.outlen);
+
+	if (ENABLE_FEATURE_CLEAN_UP) {
+		free(t.buf);
+		free(t.out);
 	}
 
 	return retval;
@@ -36,6 +36,16 @@
 //config:		-s SEC  Wait SEC seconds between reads with -f
 //config:		-v      Always output headers giving file names
 //config:		-F      Same as -f, but keep retrying
+//config:
+//config:config FEATURE_TAIL_INOTIFY
+//config:	bool "Use inotify to wait for changes with -f"
+//config:	default y
+//config:	depends on TAIL
+//config:	help
+//config:	Instead of waking up every second to check all followed files,
+//config:	wait for the kernel to report that some of them have changed.
+//config:	Files where this does not work (pipes, network filesystems)
+//config:	are still checked periodically.
 
 //applet:IF_TAIL(APPLET(tail, BB_DIR_USR_BIN, BB_SUID_DROP))
 
@@ -70,10 +80,28 @@
 
 #include "libbb.h"
 #include "common_bufsiz.h"
+#if ENABLE_FEATURE_TAIL_INOTIFY
+# include <sys/inotify.h>
+# include <sys/vfs.h>
+#endif
+
+#if ENABLE_FEATURE_TAIL_INOTIFY
+struct tail_watch {
+	int wd;      /* inotify watch of the file, or -1 */
+	int dir_wd;  /* -F: watch of its directory, or -1 */
+	smallint polled;  /* events don't tell us everything, check periodically */
+	smallint changed; /* check this file now */
+};
+#endif
 
 struct globals {
 	bool from_top;
 	bool exitcode;
+#if ENABLE_FEATURE_TAIL_INOTIFY
+	int inotify_fd;
+	struct tail_watch *tw;
+	unsigned long long polled_at;
+#endif
 } FIX_ALIASING;
 #define G (*(struct globals*)bb_common_bufsiz1)
 #define INIT_G() do { setup_common_bufsiz(); } while (0)
@@ -99,6 +127,140 @@ static ssize_t tail_read(int fd, char *buf, size_t count)
 
 #define header_fmt_str "\n==> %s <==\n"
 
+#if ENABLE_FEATURE_TAIL_INOTIFY
+/* Filesystems which don't report (all) changes via inotify */
+static int tail_fs_unwatchable(const char *path)
+{
+	struct statfs sfs;
+
+	if (statfs(path, &sfs) != 0)
+		return 1;
+	switch ((uint32_t)sfs.f_type) {
+	case 0x6969:     /* NFS */
+	case 0x517b:     /* SMB */
+	case 0xff534d42: /* CIFS */
+	case 0xfe534d42: /* SMB2 */
+	case 0x65735546: /* FUSE */
+	case 0x01021997: /* 9P */
+	case 0x00c36400: /* CEPH */
+	case 0x5346414f: /* AFS */
+	case 0x9fa0:     /* proc */
+	case 0x62656572: /* sysfs */
+		return 1;
+	}
+	return 0;
+}
+
+static void tail_watch_file(struct tail_watch *tw, const char *filename, int fd, int follow_retry)
+{
+	struct stat sbuf;
+
+	tw->polled = 1;
+	/* -F: stop watching the old file, it was renamed or deleted */
+	if (tw->wd >= 0)
+		inotify_rm_watch(G.inotify_fd, tw->wd);
+	tw->wd = -1;
+	if (fd == STDIN_FILENO)
+		return;
+	if (fd >= 0) {
+		if (fstat(fd, &sbuf) != 0
+		 || !S_ISREG(sbuf.st_mode)
+		 || tail_fs_unwatchable(filename)
+		) {
+			return;
+		}
+		tw->wd = inotify_add_watch(G.inotify_fd, filename, follow_retry
+			? (IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF)
+			: IN_MODIFY
+		);
+		if (tw->wd < 0)
+			return;
+	}
+	if (follow_retry && tw->dir_wd < 0) {
+		/* Let us know when the file is created or renamed to filename */
+		char *copy = xstrdup(filename);
+		char *dir = dirname(copy);
+
+		if (!tail_fs_unwatchable(dir))
+			tw->dir_wd = inotify_add_watch(G.inotify_fd, dir, IN_CREATE | IN_MOVED_TO);
+		free(copy);
+		if (tw->dir_wd < 0)
+			return;
+	}
+	tw->polled = 0;
+}
+
+/* -F switched to a new file */
+static void tail_rewatch(unsigned i, const char *filename, int fd)
+{
+	if (G.inotify_fd >= 0)
+		tail_watch_file(&G.tw[i], filename, fd, 1);
+}
+
+/* Wait until some of the files may have changed and mark them */
+static void tail_wait(char **argv, unsigned nfiles, unsigned sleep_period)
+{
+	struct tail_watch *tw = G.tw;
+	struct pollfd pfd;
+	int timeout = -1;
+	unsigned i;
+
+	for (i = 0; i < nfiles; i++) {
+		if (tw[i].polled) {
+			unsigned long long elapsed = monotonic_ms() - G.polled_at;
+			timeout = 0;
+			if (elapsed < sleep_period * 1000ULL)
+				timeout = sleep_period * 1000ULL - elapsed;
+			break;
+		}
+	}
+
+	pfd.fd = G.inotify_fd;
+	pfd.events = POLLIN;
+	if (safe_poll(&pfd, 1, timeout) > 0) {
+		union {
+			struct inotify_event ev;
+			char buf[sizeof(struct inotify_event) + PATH_MAX + 1];
+		} u;
+		ssize_t n = safe_read(G.inotify_fd, &u, sizeof(u));
+		char *p = u.buf;
+
+		while (n > 0 && p < u.buf + n) {
+			struct inotify_event *ev = (void*)p;
+
+			p += sizeof(*ev) + ev->len;
+			for (i = 0; i < nfiles; i++) {
+				if (ev->mask & IN_Q_OVERFLOW) {
+					tw[i].changed = 1;
+				} else if (ev->wd == tw[i].wd) {
+					tw[i].changed = 1;
+					if (ev->mask & IN_IGNORED) {
+						tw[i].wd = -1;
+						tw[i].polled = 1;
+					}
+				} else if (ev->wd == tw[i].dir_wd) {
+					if (ev->mask & IN_IGNORED) {
+						tw[i].dir_wd = -1;
+						tw[i].polled = 1;
+					} else if (ev->len && strcmp(ev->name, bb_basename(argv[i])) == 0) {
+						tw[i].changed = 1;
+					}
+				}
+			}
+		}
+	}
+
+	if (timeout >= 0 && monotonic_ms() - G.polled_at >= sleep_period * 1000ULL) {
+		for (i = 0; i < nfiles; i++)
+			if (tw[i].polled)
+				tw[i].changed = 1;
+		G.polled_at = monotonic_ms();
+	}
+}
+#else
+# define tail_rewatch(i, filename, fd) ((void)0)
+#endif
+
 static unsigned eat_num(const char *p)
 {
 	if (*p == '-')
@@ -189,6 +351,25 @@ int tail_main(int argc, char **argv)
 	if (!nfiles)
 		bb_simple_error_msg_and_die("no files");
 
+#if ENABLE_FEATURE_TAIL_INOTIFY
+	/* Start watching before we read, so that we don't miss writes
+	 * done while we are reading */
+	G.inotify_fd = -1;
+	if (FOLLOW)
+		G.inotify_fd = inotify_init();
+	if (G.inotify_fd >= 0) {
+		close_on_exec_on(G.inotify_fd);
+		G.tw = xmalloc(sizeof(G.tw[0]) * nfiles);
+		for (i = 0; i < nfiles; i++) {
+			G.tw[i].wd = -1;
+			G.tw[i].dir_wd = -1;
+			G.tw[i].changed = 0;
+			tail_watch_file(&G.tw[i], argv[i], fds[i], FOLLOW_RETRY);
+		}
+		G.polled_at = monotonic_ms();
+	}
+#endif
+
 	/* prepare the buffer */
 	tailbufsize = BUFSIZ;
 	if (!G.from_top && COUNT_BYTES) {
@@ -339,7 +520,12 @@ int tail_main(int argc, char **argv)
 	fmt = NULL;
 
 	if (FOLLOW) while (1) {
-		sleep(sleep_period);
+#if ENABLE_FEATURE_TAIL_INOTIFY
+		if (G.inotify_fd >= 0)
+			tail_wait(argv, nfiles, sleep_period);
+		else
+#endif
+			sleep(sleep_period);
 
 		i = 0;
 		do {
@@ -349,6 +535,13 @@ int tail_main(int argc, char **argv)
 			int new_fd = -1;
 			struct stat sbuf;
 
+#if ENABLE_FEATURE_TAIL_INOTIFY
+			if (G.inotify_fd >= 0) {
+				if (!G.tw[i].changed)
+					continue;
+				G.tw[i].changed = 0;
+			}
+#endif
 			if (FOLLOW_RETRY) {
 				struct stat fsbuf;
 
@@ -369,6 +562,7 @@ int tail_main(int argc, char **argv)
 							 * start using new_fd immediately. */
 							fds[i] = fd = new_fd;
 							new_fd = -1;
+							tail_rewatch(i, filename, fd);
 						}
 					} else if (fd >= 0) {
 						bb_perror_msg("%s has been renamed or deleted", filename);
@@ -401,6 +595,7 @@ int tail_main(int argc, char **argv)
 					/* Switch to "tail -F"ing the new file */
 					xmove_fd(new_fd, fd);
 					new_fd = -1;
+					tail_rewatch(i, filename, fd);
 					continue;
 				}
 				if (fmt && (fd != prev_fd)) {
@@ -318,6 +318,18 @@ int tr_main(int argc UNUSED_PARAM, char **argv)
 	for (i = 0; i < str2_length; i++)
 		outvec[(unsigned char)(str2[i])] = TRUE;
 
+	if (!(opts & (TR_OPT_delete | TR_OPT_squeeze_reps))) {
+		/* Plain translation: output size == input size,
+		 * map whole blocks in place */
+		while ((read_chars = safe_read(STDIN_FILENO, str1, TR_BUFSIZ)) > 0) {
+			translate_bytes(str1, str1, read_chars, (unsigned char *)vector);
+			xwrite(STDOUT_FILENO, str1, read_chars);
+		}
+		if (read_chars < 0)
+			bb_simple_perror_msg_and_die(bb_msg_read_error);
+		goto ret;
+	}
+
 	goto start_from;
 
 	/* In this loop, str1 space is reused as input buffer,
@@ -349,7 +361,7 @@ int tr_main(int argc UNUSED_PARAM, char **argv)
 		}
 		str2[out_index++] = last = coded;
 	}
-
+ ret:
 	if (ENABLE_FEATURE_CLEAN_UP) {
 		free(vector);
 		free(str2);
@@ -47,8 +47,10 @@ int uniq_main(int argc UNUSED_PARAM, char **argv)
 	unsigned skip_fields, skip_chars, max_chars;
 	unsigned opt;
 	char eol;
-	char *cur_line;
-	const char *cur_compare;
+	char *cur_line, *old_line;
+	size_t cur_alloc, old_alloc;
+	const char *cur_compare, *old_compare;
+	ssize_t len;
 
 	enum {
 		OPT_c = 1 << 0,
@@ -88,21 +90,23 @@ int uniq_main(int argc UNUSED_PARAM, char **argv)
 		}
 	}
 
-	cur_compare = cur_line = NULL; /* prime the pump */
+	/* Two line buffers, reused: getline() splits stdio's buffer
+	 * with memchr, lines are not allocated one by one */
+	cur_line = old_line = NULL;
+	cur_alloc = old_alloc = 0;
+	cur_compare = old_compare = NULL;
 	eol = (opt & OPT_z) ? 0 : '\n';
 
-	do {
+	for (;;) {
 		unsigned i;
 		unsigned long dups;
-		char *old_line;
-		const char *old_compare;
 
-		old_line = cur_line;
-		old_compare = cur_compare;
 		dups = 0;
 
 		/* gnu uniq ignores newlines */
-		while ((cur_line = xmalloc_fgetline(stdin)) != NULL) {
+		while ((len = getline(&cur_line, &cur_alloc, stdin)) >= 0) {
+			if (len && cur_line[len - 1] == '\n')
+				cur_line[len - 1] = '\0';
 			cur_compare = cur_line;
 			for (i = skip_fields; i; i--) {
 				cur_compare = skip_whitespace(cur_compare);
@@ -112,7 +116,7 @@ int uniq_main(int argc UNUSED_PARAM, char **argv)
 				++cur_compare;
 			}
 
-			if (!old_line)
+			if (!old_compare)
 				break;
 			if ((opt & OPT_i)
 				? strncasecmp(old_compare, cur_compare, max_chars)
@@ -121,11 +125,10 @@ int uniq_main(int argc UNUSED_PARAM, char **argv)
 				break;
 			}
 
-			free(cur_line);
 			++dups;  /* testing for overflow seems excessive */
 		}
 
-		if (old_line) {
+		if (old_compare) {
 			if (!(opt & (OPT_d << !!dups))) { /* (if dups, opt & OPT_u) */
 				if (opt & OPT_c) {
 					/* %7lu matches GNU coreutils 6.9 */
@@ -133,9 +136,21 @@ int uniq_main(int argc UNUSED_PARAM, char **argv)
 				}
 				printf("%s%c", old_line, eol);
 			}
-			free(old_line);
 		}
-	} while (cur_line);
+		if (len < 0)
+			break;
+
+		/* cur_line becomes old_line, old buffer is reused for reading */
+		{
+			char *t = old_line;
+			size_t a = old_alloc;
+			old_line = cur_line;
+			old_alloc = cur_alloc;
+			cur_line = t;
+			cur_alloc = a;
+		}
+		old_compare = cur_compare;
+	}
 
 	die_if_ferror(stdin, input_filename);
 
@@ -71,6 +71,8 @@
 # define COUNT_FMT "u"
 #endif
 
+#define WC_BUFSZ (CONFIG_FEATURE_COPYBUF_KB < 64 ? 64 * 1024 : CONFIG_FEATURE_COPYBUF_KB * 1024)
+
 /* We support -m even when UNICODE_SUPPORT is off,
  * we just don't advertise it in help text,
  * since it is the same as -c in this case.
@@ -117,6 +119,7 @@ int wc_main(int argc UNUSED_PARAM, char **argv)
 	int num_files;
 	smallint status = EXIT_SUCCESS;
 	unsigned print_type;
+	char *buf;
 
 	init_unicode();
 
@@ -140,85 +143,103 @@ int wc_main(int argc UNUSED_PARAM, char **argv)
 
 	pcounts = counts;
 
+	buf = xmalloc(WC_BUFSZ);
+
 	num_files = 0;
 	while ((arg = *argv++) != NULL) {
-		FILE *fp;
+		struct text_counts tc;
 		const char *s;
 		unsigned u;
 		unsigned linepos;
-		smallint in_word;
+		ssize_t n;
+		int fd;
 
 		++num_files;
-		fp = fopen_or_warn_stdin(arg);
-		if (!fp) {
+		fd = open_or_warn_stdin(arg);
+		if (fd < 0) {
 			status = EXIT_FAILURE;
 			continue;
 		}
 
 		memset(counts, 0, sizeof(counts));
+		memset(&tc, 0, sizeof(tc));
 		linepos = 0;
-		in_word = 0;
 
-		while (1) {
-			int c;
-			/* Our -w doesn't match GNU wc exactly... oh well */
+		while ((n = safe_read(fd, buf, WC_BUFSZ)) > 0) {
+			const unsigned char *p;
 
-			c = getc(fp);
-			if (c == EOF) {
-				if (ferror(fp)) {
-					bb_simple_perror_msg(arg);
-					status = EXIT_FAILURE;
+			counts[WC_BYTES] += n;
+			if (!(print_type & (1 << WC_LENGTH))) {
+				/* Whole blocks at a time */
+				if ((print_type & (1 << WC_WORDS))
+				 || ((print_type & (1 << WC_UNICHARS)) && unicode_status == UNICODE_ON)
+				) {
+					count_text(&tc, buf, n);
+				} else if (print_type & (1 << WC_LINES)) {
+					tc.lines += count_byte(buf, n, '\n');
 				}
-				goto DO_EOF;  /* Treat an EOF as '\r'. */
+				continue;
 			}
 
-			/* Cater for -c and -m */
-			++counts[WC_BYTES];
-			if (unicode_status != UNICODE_ON /* every byte is a new char */
-			 || (c & 0xc0) != 0x80 /* it isn't a 2nd+ byte of a Unicode char */
-			) {
-				++counts[WC_UNICHARS];
-			}
+			/* -L needs to look at every char */
+			p = (unsigned char *)buf;
+			do {
+				unsigned c = *p++;
+				/* Our -w doesn't match GNU wc exactly... oh well */
 
-			if (isprint_asciionly(c)) { /* FIXME: not unicode-aware */
-				++linepos;
-				if (!isspace(c)) {
-					in_word = 1;
-					continue;
-				}
-			} else if ((unsigned)(c - 9) <= 4) {
-				/* \t  9
-				 * \n 10
-				 * \v 11
-				 * \f 12
-				 * \r 13
-				 */
-				if (c == '\t') {
-					linepos = (linepos | 7) + 1;
-				} else {  /* '\n', '\r', '\f', or '\v' */
- DO_EOF:
-					if (linepos > counts[WC_LENGTH]) {
-						counts[WC_LENGTH] = linepos;
-					}
-					if (c == '\n') {
-						++counts[WC_LINES];
+				if ((c & 0xc0) != 0x80) /* it isn't a 2nd+ byte of a Unicode char */
+					++tc.chars;
+
+				if (isprint_asciionly(c)) { /* FIXME: not unicode-aware */
+					++linepos;
+					if (!isspace(c)) {
+						tc.in_word = 1;
+						continue;
 					}
-					if (c != '\v') {
-						linepos = 0;
+				} else if ((unsigned)(c - 9) <= 4) {
+					/* \t  9
+					 * \n 10
+					 * \v 11
+					 * \f 12
+					 * \r 13
+					 */
+					if (c == '\t') {
+						linepos = (linepos | 7) + 1;
+					} else {  /* '\n', '\r', '\f', or '\v' */
+						if (linepos > counts[WC_LENGTH]) {
+							counts[WC_LENGTH] = linepos;
+						}
+						if (c == '\n') {
+							++tc.lines;
+						}
+						if (c != '\v') {
+							linepos = 0;
+						}
 					}
+				} else {
+					continue;
 				}
-			} else {
-				continue;
-			}
 
-			counts[WC_WORDS] += in_word;
-			in_word = 0;
-			if (c == EOF) {
-				break;
-			}
+				tc.words += tc.in_word;
+				tc.in_word = 0;
+			} while (p != (unsigned char *)buf + n);
 		}
+		if (n < 0) {
+			bb_simple_perror_msg(arg);
+			status = EXIT_FAILURE;
+		}
+		if (fd != STDIN_FILENO)
+			close(fd);
 
-		fclose_if_not_stdin(fp);
+		/* Treat an EOF as '\r' */
+		if (linepos > counts[WC_LENGTH]) {
+			counts[WC_LENGTH] = linepos;
+		}
+		counts[WC_LINES] = tc.lines;
+		counts[WC_WORDS] = tc.words + tc.in_word;
+		counts[WC_UNICHARS] = tc.chars;
+		if (unicode_status != UNICODE_ON) /* every byte is a new char */
+			counts[WC_UNICHARS] = counts[WC_BYTES];
 
 		if (totals[WC_LENGTH] < counts[WC_LENGTH]) {
 			totals[WC_LENGTH] = counts[WC_LENGTH];
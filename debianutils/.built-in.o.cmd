@@ -0,0 +1 @@
+cmd_debianutils/built-in.o :=  rm -f debianutils/built-in.o; ar rcs debianutils/built-in.o
@@ -0,0 +1 @@
+cmd_debianutils/lib.a := rm -f debianutils/lib.a; ar  rcs debianutils/lib.a debianutils/pipe_progress.o debianutils/run_parts.o debianutils/start_stop_daemon.o debianutils/which.o
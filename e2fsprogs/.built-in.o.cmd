@@ -0,0 +1 @@
+cmd_e2fsprogs/built-in.o :=  rm -f e2fsprogs/built-in.o; ar rcs e2fsprogs/built-in.o
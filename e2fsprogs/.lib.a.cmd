@@ -0,0 +1 @@
+cmd_e2fsprogs/lib.a := rm -f e2fsprogs/lib.a; ar  rcs e2fsprogs/lib.a e2fsprogs/chattr.o e2fsprogs/e2fs_lib.o e2fsprogs/fsck.o e2fsprogs/lsattr.o
@@ -0,0 +1 @@
+cmd_editors/built-in.o :=  rm -f editors/built-in.o; ar rcs editors/built-in.o
@@ -0,0 +1 @@
+cmd_editors/lib.a := rm -f editors/lib.a; ar  rcs editors/lib.a editors/awk.o editors/cmp.o editors/diff.o editors/ed.o editors/patch.o editors/sed.o editors/vi.o
@@ -129,6 +129,15 @@ typedef struct var_s {
 	} x;
 } var;
 
+/* Block of temporary variables, see nvalloc() */
+typedef struct nvblock_s {
+	var *pos;
+	var *end;
+	struct nvblock_s *prev;
+	struct nvblock_s *next;
+	var nv[];
+} nvblock;
+
 /* Node chain (pattern-action chain, BEGIN, END, function bodies) */
 typedef struct chain_s {
 	struct node_s *first;
@@ -160,6 +169,7 @@ typedef struct hash_item_s {
 		struct func_s f;        /* functions hash */
 	} data;
 	struct hash_item_s *next;       /* next in chain */
+	unsigned hval;                  /* hashidx(name) */
 	char name[1];                   /* really it's longer */
 } hash_item;
 
@@ -169,6 +179,13 @@ typedef struct xhash_s {
 	unsigned nprime;        /* next hash size in PRIMES[] */
 	unsigned glen;          /* summary length of item names */
 	struct hash_item_s **items;
+	/* When the hash grows, items are moved from the old table
+	 * a few buckets at a time, not all at once: no long pause
+	 * when a big array grows.
+	 */
+	unsigned old_size;
+	unsigned old_pos;       /* old buckets below this are moved */
+	struct hash_item_s **old_items;
 } xhash;
 
 /* Tree node */
@@ -580,7 +597,10 @@ static const char vValues[] ALIGN1 =
 
 /* hash size may grow to these values */
 #define FIRST_PRIME 61
-static const uint16_t PRIMES[] ALIGN2 = { 251, 1021, 4093, 16381, 65521 };
+static const uint32_t PRIMES[] ALIGN4 = {
+	251, 1021, 4093, 16381, 65521,
+	262139, 1048573, 4194301, 16777213, 67108859
+};
 
 
 /* Globals. Split in two parts so that first one is addressed
@@ -596,6 +616,7 @@ struct globals {
 	xhash *ahash;  /* argument names, used only while parsing function bodies */
 	xhash *fnhash; /* function names, used only in parsing stage */
 	xhash *vhash;  /* variables and arrays */
+	nvblock *g_cb; /* current block of temporary variables */
 	//xhash *fdhash; /* file objects, used only in execution stage */
 	//we are reusing ahash as fdhash, via define (see later)
 	const char *g_progname;
@@ -631,6 +652,7 @@ struct globals2 {
 
 	/* former statics from various functions */
 	char *split_f0__fstrings;
+	int split_f0__fsize;
 
 	unsigned next_input_file__argind;
 	smallint next_input_file__input_file_seen;
@@ -671,6 +693,7 @@ struct globals2 {
 #define ahash        (G1.ahash       )
 #define fnhash       (G1.fnhash      )
 #define vhash        (G1.vhash       )
+#define g_cb         (G1.g_cb        )
 #define fdhash       ahash
 //^^^^^^^^^^^^^^^^^^ ahash is cleared after every function parsing,
 // and ends up empty after parsing phase. Thus, we can simply reuse it
@@ -746,11 +769,45 @@ static xhash *hash_init(void)
 	return newhash;
 }
 
+/* Move n buckets (n == 0: all of them) from the old table */
+static void hash_move_old(xhash *hash, unsigned n)
+{
+	while (hash->old_items) {
+		hash_item *hi = hash->old_items[hash->old_pos];
+		while (hi) {
+			hash_item *next = hi->next;
+			unsigned idx = hi->hval % hash->csize;
+			hi->next = hash->items[idx];
+			hash->items[idx] = hi;
+			hi = next;
+		}
+		if (++hash->old_pos == hash->old_size) {
+			free(hash->old_items);
+			hash->old_items = NULL;
+			break;
+		}
+		if (--n == 0)
+			break;
+	}
+}
+
+/* Old table bucket which still may have this item, or NULL */
+static hash_item **hash_old_bucket(xhash *hash, unsigned idx)
+{
+	if (hash->old_items) {
+		idx %= hash->old_size;
+		if (idx >= hash->old_pos)
+			return &hash->old_items[idx];
+	}
+	return NULL;
+}
+
 static void hash_clear(xhash *hash)
 {
 	unsigned i;
 	hash_item *hi, *thi;
 
+	hash_move_old(hash, 0);
 	for (i = 0; i < hash->csize; i++) {
 		hi = hash->items[i];
 		while (hi) {
@@ -777,15 +834,21 @@ static void hash_free(xhash *hash)
 /* find item in hash, return ptr to data, NULL if not found */
 static NOINLINE void *hash_search3(xhash *hash, const char *name, unsigned idx)
 {
-	hash_item *hi;
+	hash_item *hi, **old;
 
 	hi = hash->items[idx % hash->csize];
-	while (hi) {
-		if (strcmp(hi->name, name) == 0)
-			return &hi->data;
-		hi = hi->next;
+	old = hash_old_bucket(hash, idx);
+	for (;;) {
+		while (hi) {
+			if (hi->hval == idx && strcmp(hi->name, name) == 0)
+				return &hi->data;
+			hi = hi->next;
+		}
+		if (!old)
+			return NULL;
+		hi = *old;
+		old = NULL;
 	}
-	return NULL;
 }
 
 static void *hash_search(xhash *hash, const char *name)
@@ -796,29 +859,17 @@ static void *hash_search(xhash *hash, const char *name)
 /* grow hash if it becomes too big */
 static void hash_rebuild(xhash *hash)
 {
-	unsigned newsize, i, idx;
-	hash_item **newitems, *hi, *thi;
-
 	if (hash->nprime == ARRAY_SIZE(PRIMES))
 		return;
 
-	newsize = PRIMES[hash->nprime++];
-	newitems = xzalloc(newsize * sizeof(newitems[0]));
+	/* Normally long done by now */
+	hash_move_old(hash, 0);
 
-	for (i = 0; i < hash->csize; i++) {
-		hi = hash->items[i];
-		while (hi) {
-			thi = hi;
-			hi = thi->next;
-			idx = hashidx(thi->name) % newsize;
-			thi->next = newitems[idx];
-			newitems[idx] = thi;
-		}
-	}
-
-	free(hash->items);
-	hash->csize = newsize;
-	hash->items = newitems;
+	hash->old_items = hash->items;
+	hash->old_size = hash->csize;
+	hash->old_pos = 0;
+	hash->csize = PRIMES[hash->nprime++];
+	hash->items = xzalloc(hash->csize * sizeof(hash->items[0]));
 }
 
 /* find item in hash, add it if necessary. Return ptr to data */
@@ -831,18 +882,22 @@ static void *hash_find(xhash *hash, const char *name)
 	idx = hashidx(name);
 	hi = hash_search3(hash, name, idx);
 	if (!hi) {
-		if (++hash->nel > hash->csize * 8)
+		if (++hash->nel > hash->csize * 2)
 			hash_rebuild(hash);
 
 		l = strlen(name) + 1;
 		hi = xzalloc(sizeof(*hi) + l);
 		strcpy(hi->name, name);
+		hi->hval = idx;
 
 		idx = idx % hash->csize;
 		hi->next = hash->items[idx];
 		hash->items[idx] = hi;
 		hash->glen += l;
 	}
+	/* Two buckets per access: done well before the next growth */
+	if (hash->old_items)
+		hash_move_old(hash, 2);
 	return &hi->data;
 }
 
@@ -853,19 +908,27 @@ static void *hash_find(xhash *hash, const char *name)
 
 static void hash_remove(xhash *hash, const char *name)
 {
-	hash_item *hi, **phi;
+	hash_item *hi, **phi, **old;
+	unsigned idx;
 
-	phi = &hash->items[hashidx(name) % hash->csize];
-	while (*phi) {
-		hi = *phi;
-		if (strcmp(hi->name, name) == 0) {
-			hash->glen -= (strlen(name) + 1);
-			hash->nel--;
-			*phi = hi->next;
-			free(hi);
-			break;
+	idx = hashidx(name);
+	phi = &hash->items[idx % hash->csize];
+	old = hash_old_bucket(hash, idx);
+	for (;;) {
+		while ((hi = *phi) != NULL) {
+			if (hi->hval == idx && strcmp(hi->name, name) == 0) {
+				hash->glen -= (strlen(name) + 1);
+				hash->nel--;
+				*phi = hi->next;
+				free(hi);
+				return;
+			}
+			phi = &hi->next;
 		}
-		phi = &hi->next;
+		if (!old)
+			return;
+		phi = old;
+		old = NULL;
 	}
 }
 
@@ -1915,10 +1978,44 @@ static void parse_program(char *p)
 
 /* -------- program execution part -------- */
 
-/* temporary variables allocator */
+/* temporary variables allocator
+ * evaluate() needs temporaries for every node it visits, so instead
+ * of malloc+free for each, they are taken from a stack of blocks
+ * (nvalloc/nvfree calls are strictly nested). Blocks are kept
+ * for reuse once allocated.
+ */
+#define MINNVBLOCK 64
+
 static var *nvalloc(int sz)
 {
-	return xzalloc(sz * sizeof(var));
+	nvblock *cb = g_cb;
+	var *r;
+
+	if (!cb || cb->end - cb->pos < sz) {
+		/* Go to the next block, or make one */
+		nvblock *nb = cb ? cb->next : NULL;
+		if (!nb || nb->end - nb->nv < sz) {
+			int n = (sz <= MINNVBLOCK) ? MINNVBLOCK : sz;
+			/* Blocks after cb are all unused */
+			while (nb) {
+				nvblock *next = nb->next;
+				free(nb);
+				nb = next;
+			}
+			nb = xmalloc(sizeof(*nb) + n * sizeof(var));
+			nb->end = nb->nv + n;
+			nb->prev = cb;
+			nb->next = NULL;
+			if (cb)
+				cb->next = nb;
+		}
+		nb->pos = nb->nv;
+		g_cb = cb = nb;
+	}
+	r = cb->pos;
+	cb->pos += sz;
+	memset(r, 0, sz * sizeof(var));
+	return r;
 }
 
 static void nvfree(var *v, int sz)
@@ -1947,7 +2044,10 @@ static void nvfree(var *v, int sz)
 		p++;
 	}
 
-	free(v);
+	/* Pop it. Emptied block: the previous top is in the block before */
+	g_cb->pos = v;
+	while (g_cb->pos == g_cb->nv && g_cb->prev)
+		g_cb = g_cb->prev;
 }
 
 static node *mk_splitter(const char *s, tsplitter *spl)
@@ -2075,14 +2175,15 @@ static int regexec1_nonempty(const regex_t *preg, const char *s, regmatch_t pmat
 	return r;
 }
 
-static int awk_split(const char *s, node *spl, char **slist)
+/* *slist is reused if it is big enough (*slist_size bytes) */
+static int awk_split(const char *s, node *spl, char **slist, int *slist_size)
 {
 	int n;
 	char c[4];
 	char *s1;
 
 	/* in worst case, each char would be a separate field */
-	*slist = s1 = xzalloc(strlen(s) * 2 + 3);
+	*slist = s1 = qrealloc(*slist, strlen(s) * 2 + 3, slist_size);
 	strcpy(s1, s);
 
 	c[0] = c[1] = (char)spl->info;
@@ -2173,9 +2274,10 @@ static void split_f0(void)
 		return;
 
 	is_f0_split = TRUE;
-	free(fstrings);
 	fsrealloc(0);
-	n = awk_split(getvar_s(intvar[F0]), &fsplitter.n, &fstrings);
+	/* Fields point into fstrings, a copy of $0 with NULs between
+	 * fields. The buffer is reused for every record. */
+	n = awk_split(getvar_s(intvar[F0]), &fsplitter.n, &fstrings, &G.split_f0__fsize);
 	fsrealloc(n);
 	s = fstrings;
 	for (i = 0; i < n; i++) {
@@ -2290,6 +2392,7 @@ static void hashwalk_init(var *v, xhash *array)
 	debug_printf_walker(" walker@%p=%p\n", &v->x.walker, w);
 	w->cur = w->end = w->wbuf;
 	w->prev = prev_walker;
+	hash_move_old(array, 0);
 	for (i = 0; i < array->csize; i++) {
 		hi = array->items[i];
 		while (hi) {
@@ -2343,7 +2446,7 @@ static int awk_getline(rstream *rsm, var *v)
 	fd = fileno(rsm->F);
 	m = rsm->buffer;
 	if (!m)
-		m = qrealloc(m, 256, &rsm->size);
+		m = qrealloc(m, 4 * 1024, &rsm->size);
 	p = rsm->pos;
 	rp = 0;
 	pp = 0;
@@ -2394,6 +2497,8 @@ static int awk_getline(rstream *rsm, var *v)
 
 		b = m = qrealloc(m, p+128, &rsm->size);
 		pp = p;
+		/* print does not flush stdout, do it before we (possibly) block */
+		fflush(stdout);
 		p += safe_read(fd, b+p, rsm->size - p - 1);
 		if (p < pp) {
 			p = 0;
@@ -2769,6 +2874,7 @@ static NOINLINE var *exec_builtin(node *op, var *res)
 
 	case B_sp: {
 		char *s, *s1;
+		int ssize;
 
 		if (nargs > 2) {
 			spl = (an[2]->info == TI_REGEXP) ? an[2]
@@ -2777,7 +2883,8 @@ static NOINLINE var *exec_builtin(node *op, var *res)
 			spl = &fsplitter.n;
 		}
 
-		n = awk_split(as[0], spl, &s);
+		s = NULL;
+		n = awk_split(as[0], spl, &s, &ssize);
 		s1 = s;
 		clear_array(iamarray(av[1]));
 		for (i = 1; i <= n; i++)
@@ -3003,6 +3110,22 @@ static var *evaluate(node *op, var *res)
 
 	debug_printf_eval("entered %s()\n", __func__);
 
+	/* Plain variables and constants are the most common operands,
+	 * they need no temporaries (see OC_VAR/OC_FNARG below) */
+	if (!op->r.n) {
+		uint32_t opcls = op->info & OPCLSMASK;
+		if (opcls == OC_VAR || opcls == OC_CONST) {
+			g_lineno = op->lineno;
+			if (op->l.v == intvar[NF])
+				split_f0();
+			return op->l.v;
+		}
+		if (opcls == OC_FNARG) {
+			g_lineno = op->lineno;
+			return &fnargs[op->l.aidx];
+		}
+	}
+
 	tmpvars = nvalloc(2);
 #define TMPVAR0 (tmpvars)
 #define TMPVAR1 (tmpvars + 1)
@@ -3134,6 +3257,7 @@ static var *evaluate(node *op, var *res)
 				rstream *rsm = newfile(R.s);
 				if (!rsm->F) {
 					if (opn == '|') {
+						fflush(stdout);
 						rsm->F = popen(R.s, "w");
 						if (rsm->F == NULL)
 							bb_simple_perror_msg_and_die("popen");
@@ -3176,7 +3300,9 @@ static var *evaluate(node *op, var *res)
 #endif
 				free(s);
 			}
-			fflush(F);
+			/* stdout is flushed when we read input, or exit */
+			if (F != stdout)
+				fflush(F);
 			break;
 		}
 
@@ -3356,6 +3482,7 @@ static var *evaluate(node *op, var *res)
 				if (!rsm->F) {
 					/* NB: can't use "opinfo == TI_PGETLINE", would break "cmd" | getline */
 					if ((opinfo & OPCLSMASK) == OC_PGETLINE) {
+						fflush(stdout);
 						rsm->F = popen(L.s, "r");
 						rsm->is_pipe = TRUE;
 					} else {
@@ -3506,6 +3633,7 @@ static var *evaluate(node *op, var *res)
 					 * getline line <"doesnt_exist";
 					 * close("doesnt_exist"); <--- here rsm->F is NULL
 					 */
+					fflush(stdout);
 					if (rsm->F)
 						err = rsm->is_pipe ? pclose(rsm->F) : fclose(rsm->F);
 					free(rsm->buffer);
@@ -3710,6 +3838,8 @@ static int awk_exit(void)
 	}
 
 	/* waiting for children */
+	fflush(stdout);
+	hash_move_old(fdhash, 0);
 	for (i = 0; i < fdhash->csize; i++) {
 		hash_item *hi;
 		hi = fdhash->items[i];
@@ -41,15 +41,38 @@ static const char fmt_l_opt[] ALIGN1 = "%.0s%.0s%"OFF_FMT"u %3o %3o\n";
 #define CMP_OPT_l (1<<1)
 #define CMP_OPT_n (1<<2)
 
+static ssize_t xbulk_read(bulk_reader_t *br, void *buf, size_t len, const char *filename)
+{
+	ssize_t n = bulk_read(br, buf, len);
+	if (n < 0)
+		bb_simple_perror_msg_and_die(filename);
+	return n;
+}
+
+static void skip(bulk_reader_t *br, void *buf, off_t cnt, const char *filename)
+{
+	if (cnt == 0)
+		return;
+	if (lseek(br->fd, cnt, SEEK_CUR) >= 0) {
+		br->offset += cnt;
+		return;
+	}
+	while (cnt) {
+		size_t n = MIN(cnt, (off_t)BULK_READ_SIZE);
+		if ((size_t)xbulk_read(br, buf, n, filename) < n)
+			return;
+		cnt -= n;
+	}
+}
+
 int cmp_main(int argc, char **argv) MAIN_EXTERNALLY_VISIBLE;
 int cmp_main(int argc UNUSED_PARAM, char **argv)
 {
-	FILE *fp1, *fp2, *outfile = stdout;
+	bulk_reader_t r1, r2;
+	unsigned char *buf1, *buf2;
 	const char *filename1, *filename2 = "-";
 	off_t skip1 = 0, skip2 = 0, char_pos = 0;
 	int line_pos = 1; /* Hopefully won't overflow... */
-	const char *fmt;
-	int c1, c2;
 	unsigned opt;
 	int retval = 0;
 	int max_count = -1;
@@ -96,9 +119,10 @@ int cmp_main(int argc UNUSED_PARAM, char **argv)
 	xfunc_error_retval = 2;  /* missing file results in exitcode 2 */
 	if (opt & CMP_OPT_s)
 		logmode = 0;  /* -s suppresses open error messages */
-	fp1 = xfopen_stdin(filename1);
-	fp2 = xfopen_stdin(filename2);
-	if (fp1 == fp2) {		/* Paranoia check... stdin == stdin? */
+	/* Only the fds are used, the FILEs give us the error messages */
+	bulk_reader_init(&r1, fileno(xfopen_stdin(filename1)));
+	bulk_reader_init(&r2, fileno(xfopen_stdin(filename2)));
+	if (r1.fd == r2.fd) {	/* Paranoia check... stdin == stdin? */
 		/* Note that we don't bother reading stdin.  Neither does gnu wc.
 		 * But perhaps we should, so that other apps down the chain don't
 		 * get the input.  Consider 'echo hello | (cmp - - && cat -)'.
@@ -107,60 +131,69 @@ int cmp_main(int argc UNUSED_PARAM, char **argv)
 	}
 	logmode = LOGMODE_STDIO;
 
-	if (opt & CMP_OPT_l)
-		fmt = fmt_l_opt;
-	else
-		fmt = fmt_differ;
-
+	buf1 = xmalloc_bulk_buf();
+	buf2 = xmalloc_bulk_buf();
 	if (ENABLE_DESKTOP) {
-		while (skip1) { getc(fp1); skip1--; }
-		while (skip2) { getc(fp2); skip2--; }
+		skip(&r1, buf1, skip1, filename1);
+		skip(&r2, buf1, skip2, filename2);
 	}
-	do {
-		if (max_count >= 0 && --max_count < 0)
-			break;
-		c1 = getc(fp1);
-		c2 = getc(fp2);
-		++char_pos;
-		if (c1 != c2) {			/* Remember: a read error may have occurred. */
-			retval = 1;		/* But assume the files are different for now. */
-			if (c2 == EOF) {
-				/* We know that fp1 isn't at EOF or in an error state.  But to
-				 * save space below, things are setup to expect an EOF in fp1
-				 * if an EOF occurred.  So, swap things around.
-				 */
-				fp1 = fp2;
-				filename1 = filename2;
-				c1 = c2;
+
+	/* Compare whole blocks, look at single bytes only where they differ */
+	for (;;) {
+		ssize_t n1, n2, n, i;
+		size_t want = BULK_READ_SIZE;
+
+		if (max_count >= 0) {
+			if (max_count == 0)
+				break;
+			if (want > (unsigned)max_count)
+				want = max_count;
+			max_count -= want;
+		}
+		n1 = xbulk_read(&r1, buf1, want, filename1);
+		n2 = xbulk_read(&r2, buf2, want, filename2);
+		n = MIN(n1, n2);
+
+		i = 0;
+		while (i < n) {
+			const unsigned char *d;
+
+			if (memcmp(buf1 + i, buf2 + i, n - i) == 0)
+				break;
+			d = buf1 + i;
+			while (*d == buf2[d - buf1])
+				d++;
+			retval = 1;
+			if (opt & CMP_OPT_s)
+				goto done;
+			if (!(opt & CMP_OPT_l)) {
+				line_pos += count_byte(buf1, d - buf1, '\n');
+				printf(fmt_differ, filename1, filename2,
+						char_pos + (d - buf1) + 1, line_pos);
+				goto done;
 			}
-			if (c1 == EOF) {
-				die_if_ferror(fp1, filename1);
-				fmt = fmt_eof;	/* Well, no error, so it must really be EOF. */
-				outfile = stderr;
+			/* -l */
+			printf(fmt_l_opt, filename1, filename2,
+					char_pos + (d - buf1) + 1, *d, buf2[d - buf1]);
+			i = d - buf1 + 1;
+		}
+		if (!(opt & (CMP_OPT_s | CMP_OPT_l)))
+			line_pos += count_byte(buf1, n, '\n');
+		char_pos += n;
+
+		if (n1 != n2) {
+			retval = 1;
+			if (!(opt & CMP_OPT_s)) {
 				/* There may have been output to stdout (option -l), so
 				 * make sure we fflush before writing to stderr. */
 				fflush_all();
-			}
-			if (!(opt & CMP_OPT_s)) {
-				if (opt & CMP_OPT_l) {
-					line_pos = c1;	/* line_pos is unused in the -l case. */
-				}
-				fprintf(outfile, fmt, filename1, filename2, char_pos, line_pos, c2);
-				if (opt) {	/* This must be -l since not -s. */
-					/* If we encountered an EOF,
-					 * the while check will catch it. */
-					continue;
-				}
+				fprintf(stderr, fmt_eof, n1 < n2 ? filename1 : filename2);
 			}
 			break;
 		}
-		if (c1 == '\n') {
-			++line_pos;
-		}
-	} while (c1 != EOF);
-
-	die_if_ferror(fp1, filename1);
-	die_if_ferror(fp2, filename2);
-
+		if ((size_t)n1 < want)
+			break;
+	}
+ done:
 	fflush_stdout_and_exit(retval);
 }
@@ -13,50 +13,32 @@
  * Licensed under GPLv2 or later, see file LICENSE in this source tree.
  */
 /*
- * The following code uses an algorithm due to Harold Stone,
- * which finds a pair of longest identical subsequences in
- * the two files.
+ * The following code uses the O(ND) algorithm due to Eugene Myers
+ * ("An O(ND) Difference Algorithm and Its Variations", 1986),
+ * in its linear space divide-and-conquer form, as GNU diff does.
  *
  * The major goal is to generate the match vector J.
  * J[i] is the index of the line in file1 corresponding
  * to line i in file0. J[i] = 0 if there is no
  * such line in file1.
  *
- * Lines are hashed so as to work in core. All potential
- * matches are located by sorting the lines of each file
- * on the hash (called "value"). In particular, this
- * collects the equivalence classes in file1 together.
- * Subroutine equiv replaces the value of each line in
- * file0 by the index of the first element of its
- * matching equivalence in (the reordered) file1.
- * To save space equiv squeezes file1 into a single
- * array member in which the equivalence classes
- * are simply concatenated, except that their first
- * members are flagged by changing sign.
+ * Both files are read into memory (mmapped when possible) and
+ * every line is reduced to a hash value. The common prefix and
+ * suffix are trimmed off, and the shortest edit script for the
+ * remaining lines is searched for by comparing hashes.
  *
- * Next the indices that point into member are unsorted into
- * array class according to the original order of file0.
+ * The search runs simultaneously from both ends of the region,
+ * extending the furthest reaching path on each diagonal by one
+ * edit per step, until the forward and backward paths overlap.
+ * The overlap point splits the problem in two, and both halves
+ * are solved recursively. Runs of equal lines ("snakes") stripped
+ * from the ends of each subproblem are the matches recorded in J.
+ * Time is O((N+M)D) for D differences, memory is O(N+M).
  *
- * The cleverness lies in routine stone. This marches
- * through the lines of file0, developing a vector klist
- * of "k-candidates". At step i a k-candidate is a matched
- * pair of lines x,y (x in file0, y in file1) such that
- * there is a common subsequence of length k
- * between the first i lines of file0 and the first y
- * lines of file1, but there is no such subsequence for
- * any smaller y. x is the earliest possible mate to y
- * that occurs in such a subsequence.
- *
- * Whenever any of the members of the equivalence class of
- * lines in file1 matable to a line in file0 has serial number
- * less than the y of some k-candidate, that k-candidate
- * with the smallest such y is replaced. The new
- * k-candidate is chained (via pred) to the current
- * k-1 candidate so that the actual subsequence can
- * be recovered. When a member has serial number greater
- * that the y of all k-candidates, the klist is extended.
- * At the end, the longest subsequence is pulled out
- * and placed in the array J by unravel
+ * Unless -d is given, a search which takes too many steps is cut
+ * short and the best partial paths found so far are used for the
+ * split. This bounds the run time on very dissimilar inputs, at the
+ * cost of a possibly non-minimal diff.
  *
  * With J in hand, the matches there recorded are
  * checked against reality to assure that no spurious
@@ -64,15 +46,6 @@
  * they are broken, and "jackpot" is recorded--a harmless
  * matter except that a true match for a spuriously
  * mated line may now be unnecessarily reported as a change.
- *
- * Much of the complexity of the program comes simply
- * from trying to minimize core utilization and
- * maximize the range of doable problems by dynamically
- * allocating what is needed and reusing what is not.
- * The core requirements for problems larger than somewhat
- * are (in words) 2*length(file0) + length(file1) +
- * 3*(number of k-candidates installed), typically about
- * 6n words for files of length n.
  */
 //config:config DIFF
 //config:	bool "diff (13 kb)"
@@ -121,7 +94,6 @@
 //usage:     "\n	-w	Ignore all whitespace"
 
 #include "libbb.h"
-#include "common_bufsiz.h"
 
 #if 0
 # define dbg_error_msg(...) bb_error_msg(__VA_ARGS__)
@@ -157,11 +129,13 @@ enum {                  /* Commandline flags */
 };
 #define FLAG(x) (1 << FLAG_##x)
 
-/* We cache file position to avoid excessive seeking */
-typedef struct FILE_and_pos_t {
-	FILE *ft_fp;
-	off_t ft_pos;
-} FILE_and_pos_t;
+/* Whole file contents, and current read position */
+typedef struct buf_and_pos_t {
+	char *ft_buf;
+	size_t ft_len;
+	size_t ft_pos;
+	smallint ft_mmapped;
+} buf_and_pos_t;
 
 struct globals {
 	smallint exit_status;
@@ -198,27 +172,19 @@ enum {
 /* We don't really need the above, we only need to have EOF != any_real_char: */
 #define TOK2CHAR(t) ((t) & CHAR_MASK)
 
-static void seek_ft(FILE_and_pos_t *ft, off_t pos)
-{
-	if (ft->ft_pos != pos) {
-		ft->ft_pos = pos;
-		fseeko(ft->ft_fp, pos, SEEK_SET);
-	}
-}
-
 /* Reads tokens from given fp, handling -b and -w flags
  * The user must reset tok every line start
  */
-static int read_token(FILE_and_pos_t *ft, token_t tok)
+static int read_token(buf_and_pos_t *ft, token_t tok)
 {
 	tok |= TOK_EMPTY;
 	while (!(tok & TOK_EOL)) {
 		bool is_space;
 		int t;
 
-		t = fgetc(ft->ft_fp);
-		if (t != EOF)
-			ft->ft_pos++;
+		t = EOF;
+		if (ft->ft_pos < ft->ft_len)
+			t = (unsigned char)ft->ft_buf[ft->ft_pos++];
 		is_space = (t == EOF || isspace(t));
 
 		/* If t == EOF (-1), set both TOK_EOF and TOK_EOL */
@@ -265,171 +231,185 @@ static int read_token(FILE_and_pos_t *ft, token_t tok)
 	return tok;
 }
 
-struct cand {
-	int x;
-	int y;
-	int pred;
+struct line {
+	size_t offset;
+	unsigned value;
 };
 
-static int search(const int *c, int k, int y, const struct cand *list)
-{
-	int i, j;
-
-	if (list[c[k]].y < y)  /* quick look for typical case */
-		return k + 1;
-
-	for (i = 0, j = k + 1;;) {
-		const int l = (i + j) >> 1;
-		if (l > i) {
-			const int t = list[c[l]].y;
-			if (t > y)
-				j = l;
-			else if (t < y)
-				i = l;
-			else
-				return l;
-		} else
-			return l + 1;
-	}
-}
+struct myers {
+	const struct line *a;
+	const struct line *b;
+	int *fd; /* furthest reaching x on each diagonal, forward search */
+	int *bd; /* same for the backward search */
+	int *J;
+	int too_expensive;
+};
 
-static void stone(const int *a, int n, const int *b, int *J, int pref)
+/* Find a point (*px,*py) on a shortest edit script of a[xoff,xlim)
+ * and b[yoff,ylim). Diagonal d holds the points with x - y = d.
+ * If the search is abandoned as too expensive, *minimal tells
+ * which halves (bit 0: lower, bit 1: upper) are still optimal.
+ */
+static void diag(struct myers *m, int xoff, int xlim, int yoff, int ylim,
+		bool find_minimal, int *px, int *py, int *minimal)
 {
-	const unsigned isq = isqrt(n);
-	const unsigned bound =
-		(option_mask32 & FLAG(d)) ? UINT_MAX : MAX(256, isq);
-	int clen = 1;
-	int clistlen = 100;
-	int k = 0;
-	struct cand *clist = xzalloc(clistlen * sizeof(clist[0]));
-	struct cand cand;
-	struct cand *q;
-	int *klist = xzalloc((n + 2) * sizeof(klist[0]));
-	/*clist[0] = (struct cand){0}; - xzalloc did it */
-	/*klist[0] = 0; */
-
-	for (cand.x = 1; cand.x <= n; cand.x++) {
-		int j = a[cand.x], oldl = 0;
-		unsigned numtries = 0;
-		if (j == 0)
+	int *const fd = m->fd;
+	int *const bd = m->bd;
+	const int dmin = xoff - ylim;
+	const int dmax = xlim - yoff;
+	const int fmid = xoff - yoff;
+	const int bmid = xlim - ylim;
+	int fmin = fmid, fmax = fmid;
+	int bmin = bmid, bmax = bmid;
+	const bool odd = (fmid - bmid) & 1;
+	int c, d;
+
+	*minimal = 3;
+	fd[fmid] = xoff;
+	bd[bmid] = xlim;
+
+	for (c = 1;; c++) {
+		/* Extend the forward search by one edit on each diagonal */
+		if (fmin > dmin)
+			fd[--fmin - 1] = -1;
+		else
+			fmin++;
+		if (fmax < dmax)
+			fd[++fmax + 1] = -1;
+		else
+			fmax--;
+		for (d = fmax; d >= fmin; d -= 2) {
+			int x, y, tlo = fd[d - 1], thi = fd[d + 1];
+
+			x = tlo < thi ? thi : tlo + 1;
+			y = x - d;
+			while (x < xlim && y < ylim && m->a[x].value == m->b[y].value)
+				x++, y++;
+			fd[d] = x;
+			if (odd && bmin <= d && d <= bmax && bd[d] <= x) {
+				*px = x;
+				*py = y;
+				return;
+			}
+		}
+
+		/* Same for the backward search */
+		if (bmin > dmin)
+			bd[--bmin - 1] = INT_MAX;
+		else
+			bmin++;
+		if (bmax < dmax)
+			bd[++bmax + 1] = INT_MAX;
+		else
+			bmax--;
+		for (d = bmax; d >= bmin; d -= 2) {
+			int x, y, tlo = bd[d - 1], thi = bd[d + 1];
+
+			x = tlo < thi ? tlo : thi - 1;
+			y = x - d;
+			while (xoff < x && yoff < y && m->a[x - 1].value == m->b[y - 1].value)
+				x--, y--;
+			bd[d] = x;
+			if (!odd && fmin <= d && d <= fmax && x <= fd[d]) {
+				*px = x;
+				*py = y;
+				return;
+			}
+		}
+
+		if (find_minimal || c < m->too_expensive)
 			continue;
-		cand.y = -b[j];
-		cand.pred = klist[0];
-		do {
-			int l, tc;
-			if (cand.y <= clist[cand.pred].y)
-				continue;
-			l = search(klist, k, cand.y, clist);
-			if (l != oldl + 1)
-				cand.pred = klist[l - 1];
-			if (l <= k && clist[klist[l]].y <= cand.y)
-				continue;
-			if (clen == clistlen) {
-				clistlen = clistlen * 11 / 10;
-				clist = xrealloc(clist, clistlen * sizeof(clist[0]));
+
+		/* Gone well beyond the call of duty: split at the better of
+		 * the forward path reaching furthest (max x+y) and the backward
+		 * path reaching furthest (min x+y) */
+		{
+			int fxybest = -1, fxbest = 0;
+			int bxybest = INT_MAX, bxbest = 0;
+
+			for (d = fmax; d >= fmin; d -= 2) {
+				int x = MIN(fd[d], xlim);
+				int y = x - d;
+				if (ylim < y) {
+					x = ylim + d;
+					y = ylim;
+				}
+				if (fxybest < x + y) {
+					fxybest = x + y;
+					fxbest = x;
+				}
+			}
+			for (d = bmax; d >= bmin; d -= 2) {
+				int x = MAX(xoff, bd[d]);
+				int y = x - d;
+				if (y < yoff) {
+					x = yoff + d;
+					y = yoff;
+				}
+				if (x + y < bxybest) {
+					bxybest = x + y;
+					bxbest = x;
+				}
 			}
-			clist[clen] = cand;
-			tc = klist[l];
-			klist[l] = clen++;
-			if (l <= k) {
-				cand.pred = tc;
-				oldl = l;
-				numtries++;
+			if ((xlim + ylim) - bxybest < fxybest - (xoff + yoff)) {
+				*px = fxbest;
+				*py = fxybest - fxbest;
+				*minimal = 1;
 			} else {
-				k++;
-				break;
+				*px = bxbest;
+				*py = bxybest - bxbest;
+				*minimal = 2;
 			}
-		} while ((cand.y = b[++j]) > 0 && numtries < bound);
+			return;
+		}
 	}
-	/* Unravel */
-	for (q = clist + klist[k]; q->y; q = clist + q->pred)
-		J[q->x + pref] = q->y + pref;
-	free(klist);
-	free(clist);
 }
 
-struct line {
-	/* 'serial' is not used in the beginning, so we reuse it
-	 * to store line offsets, thus reducing memory pressure
-	 */
-	union {
-		unsigned serial;
-		off_t offset;
-	};
-	unsigned value;
-};
-
-static void equiv(struct line *a, int n, struct line *b, int m, int *c)
+/* Record in J the matching lines of a[xoff,xlim) and b[yoff,ylim) */
+static void compareseq(struct myers *m, int xoff, int xlim, int yoff, int ylim,
+		bool find_minimal)
 {
-	int i = 1, j = 1;
+	int x, y, minimal;
 
-	while (i <= n && j <= m) {
-		if (a[i].value < b[j].value)
-			a[i++].value = 0;
-		else if (a[i].value == b[j].value)
-			a[i++].value = j;
-		else
-			j++;
-	}
-	while (i <= n)
-		a[i++].value = 0;
-	b[m + 1].value = 0;
-	j = 0;
-	while (++j <= m) {
-		c[j] = -b[j].serial;
-		while (b[j + 1].value == b[j].value) {
-			j++;
-			c[j] = b[j].serial;
-		}
-	}
-	c[j] = -1;
-}
+	/* Strip and record equal lines at both ends */
+	while (xoff < xlim && yoff < ylim && m->a[xoff].value == m->b[yoff].value)
+		m->J[xoff++] = yoff++;
+	while (xoff < xlim && yoff < ylim && m->a[xlim - 1].value == m->b[ylim - 1].value)
+		m->J[--xlim] = --ylim;
 
-static void unsort(const struct line *f, int l, int *b)
-{
-	int i;
-	int *a = xmalloc((l + 1) * sizeof(a[0]));
-	for (i = 1; i <= l; i++)
-		a[f[i].serial] = f[i].value;
-	for (i = 1; i <= l; i++)
-		b[i] = a[i];
-	free(a);
-}
+	/* The rest is all insertions or all deletions? */
+	if (xoff == xlim || yoff == ylim)
+		return;
 
-static int line_compar(const void *a, const void *b)
-{
-#define l0 ((const struct line*)a)
-#define l1 ((const struct line*)b)
-	int r = l0->value - l1->value;
-	if (r)
-		return r;
-	return l0->serial - l1->serial;
-#undef l0
-#undef l1
+	diag(m, xoff, xlim, yoff, ylim, find_minimal, &x, &y, &minimal);
+	compareseq(m, xoff, x, yoff, y, minimal & 1);
+	compareseq(m, x, xlim, y, ylim, minimal >> 1);
 }
 
-static void fetch(FILE_and_pos_t *ft, const off_t *ix, int a, int b, int ch)
+static void fetch(buf_and_pos_t *ft, const size_t *ix, int a, int b, int ch)
 {
-	int i, j, col;
+	int i, col;
 	for (i = a; i <= b; i++) {
-		seek_ft(ft, ix[i - 1]);
+		const char *p = ft->ft_buf + ix[i - 1];
+		const char *end = ft->ft_buf + MIN(ix[i], ft->ft_len);
 		putchar(ch);
 		if (option_mask32 & FLAG(T))
 			putchar('\t');
-		for (j = 0, col = 0; j < ix[i] - ix[i - 1]; j++) {
-			int c = fgetc(ft->ft_fp);
-			if (c == EOF) {
-				puts("\n\\ No newline at end of file");
-				return;
-			}
-			ft->ft_pos++;
-			if (c == '\t' && (option_mask32 & FLAG(t)))
+		if (!(option_mask32 & FLAG(t)))
+			fwrite(p, 1, end - p, stdout);
+		else for (col = 0; p < end; p++) {
+			if (*p == '\t')
 				do putchar(' '); while (++col & 7);
 			else {
-				putchar(c);
+				putchar(*p);
 				col++;
 			}
 		}
+		/* Line offsets count EOF as a char */
+		if (ix[i] > ft->ft_len) {
+			puts("\n\\ No newline at end of file");
+			return;
+		}
 	}
 }
 
@@ -439,19 +419,22 @@ static void fetch(FILE_and_pos_t *ft, const off_t *ix, int a, int b, int ch)
  * being used instead to denote no corresponding line.
  * This vector is dynamically allocated and must be freed by the caller.
  *
- * * fp is an input parameter, where fp[0] and fp[1] are the open
- *   old file and new file respectively.
+ * * ft is an input parameter, where ft[0] and ft[1] are the
+ *   contents of the old file and new file respectively.
  * * nlen is an output variable, where nlen[0] and nlen[1]
  *   gets the number of lines in the old and new file respectively.
  * * ix is an output variable, where ix[0] and ix[1] gets
  *   assigned dynamically allocated vectors of the offsets of the lines
  *   of the old and new file respectively. These must be freed by the caller.
  */
-static NOINLINE int *create_J(FILE_and_pos_t ft[2], int nlen[2], off_t *ix[2])
+static NOINLINE int *create_J(buf_and_pos_t ft[2], int nlen[2], size_t *ix[2])
 {
-	int *J, slen[2], *class, *member;
-	struct line *nfile[2], *sfile[2];
+	int *J;
+	struct line *nfile[2];
+	struct myers m;
 	int pref = 0, suff = 0, i, j, delta;
+	/* Without -b/-i/-w, lines are compared byte by byte */
+	const bool raw = !(option_mask32 & (FLAG(b) | FLAG(i) | FLAG(w)));
 
 	/* Lines of both files are hashed, and in the process
 	 * their offsets are stored in the array ix[fileno]
@@ -463,13 +446,36 @@ static NOINLINE int *create_J(FILE_and_pos_t ft[2], int nlen[2], off_t *ix[2])
 		token_t tok;
 		size_t sz = 100;
 		nfile[i] = xmalloc((sz + 3) * sizeof(nfile[i][0]));
-		/* ft gets here without the correct position, cant use seek_ft */
 		ft[i].ft_pos = 0;
-		fseeko(ft[i].ft_fp, 0, SEEK_SET);
 
 		nlen[i] = 0;
 		/* We could zalloc nfile, but then zalloc starts showing in gprof at ~1% */
 		nfile[i][0].offset = 0;
+		if (raw) {
+			const unsigned char *p = (void *)ft[i].ft_buf;
+			const unsigned char *end = p + ft[i].ft_len;
+			while (p != end) {
+				unsigned c;
+				/* Same hash as read_token() loop below would give */
+				hash = 0;
+				do {
+					c = *p++;
+					hash = hash * 127 + c;
+				} while (c != '\n' && p != end);
+				if (nlen[i]++ == sz) {
+					sz = sz * 3 / 2;
+					nfile[i] = xrealloc(nfile[i], (sz + 3) * sizeof(nfile[i][0]));
+				}
+				nfile[i][nlen[i]].offset = p - (const unsigned char *)ft[i].ft_buf;
+				if (c != '\n') {
+					/* EOF counts as a token */
+					hash = hash * 127 + CHAR_MASK;
+					nfile[i][nlen[i]].offset++;
+				}
+				nfile[i][nlen[i]].value = hash;
+			}
+			goto got_lines;
+		}
 		goto start; /* saves code */
 		while (1) {
 			tok = read_token(&ft[i], tok);
@@ -485,9 +491,7 @@ static NOINLINE int *create_J(FILE_and_pos_t ft[2], int nlen[2], off_t *ix[2])
 				sz = sz * 3 / 2;
 				nfile[i] = xrealloc(nfile[i], (sz + 3) * sizeof(nfile[i][0]));
 			}
-			/* line_compar needs hashes fit into positive int */
-			nfile[i][nlen[i]].value = hash & INT_MAX;
-			/* like ftello(ft[i].ft_fp) but faster (avoids lseek syscall) */
+			nfile[i][nlen[i]].value = hash;
 			nfile[i][nlen[i]].offset = ft[i].ft_pos;
 			if (tok & TOK_EOF) {
 				/* EOF counts as a token, so we have to adjust it here */
@@ -500,6 +504,7 @@ start:
 		/* Exclude lone EOF line from the end of the file, to make fetch()'s job easier */
 		if (nfile[i][nlen[i]].offset - nfile[i][nlen[i] - 1].offset == 1)
 			nlen[i]--;
+ got_lines:
 		/* Now we copy the line offsets into ix */
 		ix[i] = xmalloc((nlen[i] + 2) * sizeof(ix[i][0]));
 		for (j = 0; j < nlen[i] + 1; j++)
@@ -513,56 +518,35 @@ start:
 	for (; suff < nlen[0] - pref && suff < nlen[1] - pref &&
 	       nfile[0][nlen[0] - suff].value == nfile[1][nlen[1] - suff].value;
 	       suff++);
-	/* Arrays are pruned by the suffix and prefix length,
-	 * the result being sorted and stored in sfile[fileno],
-	 * and their sizes are stored in slen[fileno]
-	 */
-	for (j = 0; j < 2; j++) {
-		sfile[j] = nfile[j] + pref;
-		slen[j] = nlen[j] - pref - suff;
-		for (i = 0; i <= slen[j]; i++)
-			sfile[j][i].serial = i;
-		qsort(sfile[j] + 1, slen[j], sizeof(*sfile[j]), line_compar);
-	}
-	/* nfile arrays are reused to reduce memory pressure
-	 * The #if zeroed out section performs the same task as the
-	 * one in the #else section.
-	 * Peak memory usage is higher, but one array copy is avoided
-	 * by not using unsort()
-	 */
-#if 0
-	member = xmalloc((slen[1] + 2) * sizeof(member[0]));
-	equiv(sfile[0], slen[0], sfile[1], slen[1], member);
-	free(nfile[1]);
 
-	class = xmalloc((slen[0] + 1) * sizeof(class[0]));
-	for (i = 1; i <= slen[0]; i++) /* Unsorting */
-		class[sfile[0][i].serial] = sfile[0][i].value;
-	free(nfile[0]);
-#else
-	member = (int *)nfile[1];
-	equiv(sfile[0], slen[0], sfile[1], slen[1], member);
-	member = xrealloc(member, (slen[1] + 2) * sizeof(member[0]));
-
-	class = (int *)nfile[0];
-	unsort(sfile[0], slen[0], (int *)nfile[0]);
-	class = xrealloc(class, (slen[0] + 2) * sizeof(class[0]));
-#endif
 	J = xmalloc((nlen[0] + 2) * sizeof(J[0]));
 	/* The elements of J which fall inside the prefix and suffix regions
 	 * are marked as unchanged, while the ones which fall outside
-	 * are initialized with 0 (no matches), so that function stone can
+	 * are initialized with 0 (no matches), so that compareseq can
 	 * then assign them their right values
 	 */
 	for (i = 0, delta = nlen[1] - nlen[0]; i <= nlen[0]; i++)
 		J[i] = i <= pref            ?  i :
 		       i > (nlen[0] - suff) ? (i + delta) : 0;
+
 	/* Here the magic is performed */
-	stone(class, slen[0], member, J, pref);
+	m.a = nfile[0];
+	m.b = nfile[1];
+	m.J = J;
+	/* Give up on a minimal diff after sqrt(N+M) steps, but not before 256 */
+	m.too_expensive = MAX(256, isqrt(nlen[0] + nlen[1]));
+	/* Diagonals range from -nlen[1]-1 to nlen[0]+1 */
+	m.fd = xmalloc((nlen[0] + nlen[1] + 3) * 2 * sizeof(int));
+	m.bd = m.fd + nlen[0] + nlen[1] + 3;
+	m.fd += nlen[1] + 1;
+	m.bd += nlen[1] + 1;
+	compareseq(&m, pref + 1, nlen[0] - suff + 1, pref + 1, nlen[1] - suff + 1,
+			option_mask32 & FLAG(d));
 	J[nlen[0] + 1] = nlen[1] + 1;
 
-	free(class);
-	free(member);
+	free(m.fd - (nlen[1] + 1));
+	free(nfile[0]);
+	free(nfile[1]);
 
 	/* Both files are rescanned, in an effort to find any lines
 	 * which, due to limitations intrinsic to any hashing algorithm,
@@ -572,8 +556,22 @@ start:
 		if (!J[i])
 			continue;
 
-		seek_ft(&ft[0], ix[0][i - 1]);
-		seek_ft(&ft[1], ix[1][J[i] - 1]);
+		if (raw) {
+			size_t len0 = ix[0][i] - ix[0][i - 1];
+			size_t len1 = ix[1][J[i]] - ix[1][J[i] - 1];
+			/* Lines ending in EOF have it counted in their length */
+			bool eof0 = ix[0][i] > ft[0].ft_len;
+			bool eof1 = ix[1][J[i]] > ft[1].ft_len;
+			if (len0 != len1 || eof0 != eof1
+			 || memcmp(ft[0].ft_buf + ix[0][i - 1], ft[1].ft_buf + ix[1][J[i] - 1], len0 - eof0) != 0
+			) {
+				J[i] = 0; /* Break the correspondence */
+			}
+			continue;
+		}
+
+		ft[0].ft_pos = ix[0][i - 1];
+		ft[1].ft_pos = ix[1][J[i] - 1];
 
 		for (j = J[i]; i <= nlen[0] && J[i] == j; i++, j++) {
 			token_t tok0 = 0, tok1 = 0;
@@ -593,21 +591,16 @@ start:
 	return J;
 }
 
-static bool diff(FILE* fp[2], char *file[2])
+static bool diff(buf_and_pos_t ft[2], char *file[2])
 {
 	int nlen[2];
-	off_t *ix[2];
-	FILE_and_pos_t ft[2];
+	size_t *ix[2];
 	typedef struct { int a, b; } vec_t[2];
 	vec_t *vec = NULL;
 	int i = 1, j, k, idx = -1;
 	bool anychange = false;
 	int *J;
 
-	ft[0].ft_fp = fp[0];
-	ft[1].ft_fp = fp[1];
-	/* note that ft[i].ft_pos is unintitalized, create_J()
-	 * must not assume otherwise */
 	J = create_J(ft, nlen, ix);
 
 	do {
@@ -704,14 +697,39 @@ static bool diff(FILE* fp[2], char *file[2])
 	return anychange;
 }
 
+/* Regular files are mmapped, anything else is read into memory */
+static void load_ft(buf_and_pos_t *ft, int fd)
+{
+	struct stat st;
+
+	ft->ft_pos = 0;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+	 && st.st_size > 0 && st.st_size == (size_t)st.st_size
+	) {
+		void *p = mmap_read(fd, st.st_size);
+		if (p != MAP_FAILED) {
+			ft->ft_buf = p;
+			ft->ft_len = st.st_size;
+			ft->ft_mmapped = 1;
+			return;
+		}
+	}
+	/* For stdin: compare the whole file, not just the unread part */
+	lseek(fd, 0, SEEK_SET);
+	ft->ft_len = ~(size_t)0; /* no limit */
+	ft->ft_buf = xmalloc_read(fd, &ft->ft_len);
+	if (!ft->ft_buf)
+		bb_simple_perror_msg_and_die(bb_msg_read_error);
+}
+
 static int diffreg(char *file[2])
 {
-	FILE *fp[2];
-	bool binary = false, differ = false;
+	buf_and_pos_t ft[2];
+	size_t len;
+	bool differ;
 	int status = STATUS_SAME, i;
 
-	fp[0] = stdin;
-	fp[1] = stdin;
+	memset(ft, 0, sizeof(ft));
 	for (i = 0; i < 2; i++) {
 		int fd = STDIN_FILENO;
 		if (!LONE_DASH(file[i])) {
@@ -726,57 +744,33 @@ static int diffreg(char *file[2])
 					fd = xopen("/dev/null", O_RDONLY);
 			}
 		}
-		/* Our diff implementation is using seek.
-		 * When we meet non-seekable file, we must make a temp copy.
-		 */
-		if (lseek(fd, 0, SEEK_SET) == -1 && errno == ESPIPE) {
-			char name[] = "/tmp/difXXXXXX";
-			int fd_tmp = xmkstemp(name);
-
-			unlink(name);
-			if (bb_copyfd_eof(fd, fd_tmp) < 0)
-				xfunc_die();
-			if (fd != STDIN_FILENO)
-				close(fd);
-			fd = fd_tmp;
-			xlseek(fd, 0, SEEK_SET);
-		}
-		fp[i] = fdopen(fd, "r");
+		load_ft(&ft[i], fd);
+		if (fd != STDIN_FILENO)
+			close(fd);
 	}
 
-	setup_common_bufsiz();
-	while (1) {
-		const size_t sz = COMMON_BUFSIZE / 2;
-		char *const buf0 = bb_common_bufsiz1;
-		char *const buf1 = buf0 + sz;
-		int j, k;
-		i = fread(buf0, 1, sz, fp[0]);
-		j = fread(buf1, 1, sz, fp[1]);
-		if (i != j) {
-			differ = true;
-			i = MIN(i, j);
-		}
-		if (i == 0)
-			break;
-		for (k = 0; k < i; k++) {
-			if (!buf0[k] || !buf1[k])
-				binary = true;
-			if (buf0[k] != buf1[k])
-				differ = true;
-		}
-	}
+	differ = (ft[0].ft_len != ft[1].ft_len);
+	len = MIN(ft[0].ft_len, ft[1].ft_len);
+	if (!differ)
+		differ = (memcmp(ft[0].ft_buf, ft[1].ft_buf, len) != 0);
 	if (differ) {
-		if (binary && !(option_mask32 & FLAG(a)))
+		/* NUL in the common length part means "binary" */
+		if (!(option_mask32 & FLAG(a))
+		 && (memchr(ft[0].ft_buf, '\0', len) || memchr(ft[1].ft_buf, '\0', len))
+		) {
 			status = STATUS_BINARY;
-		else if (diff(fp, file))
+		} else if (diff(ft, file))
 			status = STATUS_DIFFER;
 	}
 	if (status != STATUS_SAME)
 		exit_status |= 1;
-out:
-	fclose_if_not_stdin(fp[0]);
-	fclose_if_not_stdin(fp[1]);
-
+ out:
+	for (i = 0; i < 2; i++) {
+		if (ft[i].ft_mmapped)
+			munmap(ft[i].ft_buf, ft[i].ft_len);
+		else
+			free(ft[i].ft_buf);
+	}
 	return status;
 }
 
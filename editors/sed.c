@@ -126,6 +126,7 @@ typedef struct sed_cmd_s {
 	unsigned invert:1;      /* the '!' after the address */
 	unsigned in_match:1;    /* Next line also included in match? */
 	unsigned sub_p:1;       /* (s) print option */
+	unsigned sub_literal:1; /* (s) match and replacement are plain strings */
 
 	char sw_last_char;      /* Last line written by (sw) had no '\n' */
 
@@ -133,6 +134,18 @@ typedef struct sed_cmd_s {
 	char cmd;               /* The command char: abcdDgGhHilnNpPqrstwxy:={} */
 } sed_cmd_t;
 
+/* All regex_t's we compile are really this.
+ * Every match contains lit[], if lit[] is not empty we search for it
+ * with strstr() before trying regexec(): most lines do not match.
+ */
+typedef struct sed_regex_t {
+	regex_t re;
+	smallint lit_is_whole;  /* regex is just lit[], no special chars */
+	char lit[1];
+} sed_regex_t;
+
+#define SED_IOBUF_SIZE (64 * 1024)
+
 static const char semicolon_whitespace[] ALIGN1 = "; \n\r\t\v";
 
 struct globals {
@@ -147,6 +160,7 @@ struct globals {
 	int current_input_file, last_input_file;
 	char **input_file_list;
 	FILE *current_fp;
+	char *inbuf, *outbuf; /* -i stdio buffers */
 
 	regmatch_t regmatch[10];
 	regex_t *previous_regex_ptr;
@@ -247,6 +261,46 @@ static FILE *sed_xfopen_w(const char *fname)
 	return cur->fp;
 }
 
+static regex_t *sed_xregcomp(const char *pat, int cflags)
+{
+	sed_regex_t *r;
+	const char *s;
+	char *d;
+	smallint anchored;
+
+	r = xzalloc(sizeof(*r) + strlen(pat));
+	xregcomp(&r->re, pat, cflags);
+
+	/* Alternation: no string is common to all matches.
+	 * (Conservative: '|' can also be a literal char in BRE) */
+	if ((cflags & REG_ICASE) || strchr(pat, '|'))
+		return &r->re;
+
+	s = pat;
+	anchored = (*s == '^');
+	s += anchored;
+	d = r->lit;
+	while (*s && !strchr("\\.[]*^$+?(){}", *s))
+		*d++ = *s++;
+	if (*s == '\0') {
+		r->lit_is_whole = (!anchored && d != r->lit);
+	} else if (d != r->lit) {
+		/* Last char might be made optional by "*", "\{0\}"... */
+		*--d = '\0';
+	}
+	dbg("regex '%s': literal '%s' whole:%d", pat, r->lit, r->lit_is_whole);
+	return &r->re;
+}
+
+static int sed_regexec(regex_t *re, const char *str, size_t nmatch, regmatch_t *pmatch, int eflags)
+{
+	const char *lit = ((sed_regex_t *)re)->lit;
+
+	if (lit[0] && !strstr(str, lit))
+		return REG_NOMATCH;
+	return regexec(re, str, nmatch, pmatch, eflags);
+}
+
 /* If something bad happens during -i operation, delete temp file */
 
 static void cleanup_outname(void)
@@ -396,8 +450,7 @@ static int get_address(const char *my_str, int *linenum, regex_t ** regex)
 		next = index_of_next_unescaped_regexp_delim(delimiter, ++pos);
 		if (next != 0) {
 			temp = copy_parsing_escapes(pos, next, 0);
-			G.previous_regex_ptr = *regex = xzalloc(sizeof(regex_t));
-			xregcomp(*regex, temp, G.regex_type);
+			G.previous_regex_ptr = *regex = sed_xregcomp(temp, G.regex_type);
 			free(temp);
 		} else {
 			*regex = G.previous_regex_ptr;
@@ -516,10 +569,12 @@ static int parse_subst_cmd(sed_cmd_t *sed_cmd, const char *substr)
 	/* compile the match string into a regex */
 	if (*match != '\0') {
 		/* If match is empty, we use last regex used at runtime */
-		sed_cmd->sub_match = xzalloc(sizeof(regex_t));
 		dbg("xregcomp('%s',%x)", match, cflags);
-		xregcomp(sed_cmd->sub_match, match, cflags);
+		sed_cmd->sub_match = sed_xregcomp(match, cflags);
 		dbg("regcomp ok");
+		/* "s/str/repl/" without backrefs does not need regex at all */
+		sed_cmd->sub_literal = ((sed_regex_t *)sed_cmd->sub_match)->lit_is_whole
+				&& !strpbrk(sed_cmd->string, "&\\");
 	}
 	free(match);
 
@@ -818,6 +873,53 @@ static void do_subst_w_backrefs(char *line, char *replace)
 	}
 }
 
+/* do_subst_command() for plain strings: strstr() instead of regexec() */
+static int do_subst_literal(sed_cmd_t *sed_cmd, char **line_p)
+{
+	const char *lit = ((sed_regex_t *)sed_cmd->sub_match)->lit;
+	const char *repl = sed_cmd->string;
+	unsigned which = sed_cmd->which_match;
+	unsigned count;
+	int llen, rlen;
+	char *line, *out, *d;
+	const char *s, *p;
+
+	/* Count replacements to size the result */
+	line = *line_p;
+	llen = strlen(lit);
+	count = 0;
+	for (s = line; (p = strstr(s, lit)) != NULL; s = p + llen) {
+		if (++count == which)
+			break;
+	}
+	if (count == 0 || count < which)
+		return 0;
+	if (which)
+		count = 1;
+
+	rlen = strlen(repl);
+	out = d = xmalloc(strlen(line) - (size_t)count * llen + (size_t)count * rlen + 1);
+	count = 0;
+	for (s = line; (p = strstr(s, lit)) != NULL; s = p + llen) {
+		if (which && ++count != which) {
+			/* Not the one we want: copy it unchanged */
+			d = mempcpy(d, s, p + llen - s);
+			continue;
+		}
+		d = mempcpy(d, s, p - s);
+		d = mempcpy(d, repl, rlen);
+		if (which) {
+			s = p + llen;
+			break;
+		}
+	}
+	strcpy(d, s);
+
+	free(line);
+	*line_p = out;
+	return 1;
+}
+
 static int do_subst_command(sed_cmd_t *sed_cmd, char **line_p)
 {
 	char *line = *line_p;
@@ -836,9 +938,12 @@ static int do_subst_command(sed_cmd_t *sed_cmd, char **line_p)
 	}
 	G.previous_regex_ptr = current_regex;
 
+	if (sed_cmd->sub_literal)
+		return do_subst_literal(sed_cmd, line_p);
+
 	/* Find the first match */
 	dbg("matching '%s'", line);
-	if (REG_NOMATCH == regexec(current_regex, line, 10, G.regmatch, 0)) {
+	if (REG_NOMATCH == sed_regexec(current_regex, line, 10, G.regmatch, 0)) {
 		dbg("no match");
 		return 0;
 	}
@@ -920,7 +1025,7 @@ static int do_subst_command(sed_cmd_t *sed_cmd, char **line_p)
 		}
 
 //maybe (end ? REG_NOTBOL : 0) instead of unconditional REG_NOTBOL?
-	} while (regexec(current_regex, line, 10, G.regmatch, REG_NOTBOL) != REG_NOMATCH);
+	} while (sed_regexec(current_regex, line, 10, G.regmatch, REG_NOTBOL) != REG_NOMATCH);
 
 	/* Copy rest of string into output pipeline */
 	while (1) {
@@ -1053,6 +1158,8 @@ static char *get_next_line(char *gets_char, char *last_puts_char)
 					G.exitcode = EXIT_FAILURE;
 					continue;
 				}
+				if (G.inbuf)
+					setvbuf(fp, G.inbuf, _IOFBF, SED_IOBUF_SIZE);
 			}
 			G.current_fp = fp;
 		}
@@ -1097,7 +1204,7 @@ static char *get_next_line(char *gets_char, char *last_puts_char)
 
 static int beg_match(sed_cmd_t *sed_cmd, const char *pattern_space)
 {
-	int retval = sed_cmd->beg_match && !regexec(sed_cmd->beg_match, pattern_space, 0, NULL, 0);
+	int retval = sed_cmd->beg_match && !sed_regexec(sed_cmd->beg_match, pattern_space, 0, NULL, 0);
 	if (retval)
 		G.previous_regex_ptr = sed_cmd->beg_match;
 	return retval;
@@ -1213,7 +1320,7 @@ static void process_files(void)
 				)
 				/* or does this line matches our last address regex */
 				|| (sed_cmd->end_match && old_matched
-				     && (regexec(sed_cmd->end_match,
+				     && (sed_regexec(sed_cmd->end_match,
 						pattern_space, 0, NULL, 0) == 0)
 				)
 			);
@@ -1641,6 +1748,12 @@ int sed_main(int argc UNUSED_PARAM, char **argv)
 			G.outname = xasprintf("%sXXXXXX", *argv);
 			nonstdoutfd = xmkstemp(G.outname);
 			G.nonstdout = xfdopen_for_write(nonstdoutfd);
+			/* Whole files are rewritten: use big buffers */
+			if (!G.outbuf) {
+				G.outbuf = xmalloc(SED_IOBUF_SIZE);
+				G.inbuf = xmalloc(SED_IOBUF_SIZE);
+			}
+			setvbuf(G.nonstdout, G.outbuf, _IOFBF, SED_IOBUF_SIZE);
 			/* Set permissions/owner of output file */
 			/* chmod'ing AFTER chown would preserve suid/sgid bits,
 			 * but GNU sed 4.2.1 does not preserve them either */
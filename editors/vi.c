@@ -295,6 +295,9 @@ struct globals {
 	char *text, *end;       // pointers to the user data in memory
 	char *dot;              // where all the action takes place
 	int text_size;		// size of the allocated buffer
+	int gap_size;		// in insert mode, text after "end" is parked
+	int gap_tail;		// "gap_size" bytes further: its length
+	int gap_lines;		// and number of lines, see text_gap_open()
 
 	// the rest
 #if ENABLE_FEATURE_VI_SETOPTS
@@ -392,6 +395,9 @@ struct globals {
 #endif
 	int refresh__old_offset;
 	int format_edit_status__tot;
+	int format_edit_status__cur;
+	size_t format_edit_status__dot_ofs;
+	size_t format_edit_status__end_ofs;
 
 	// a few references only
 #if ENABLE_FEATURE_VI_YANKMARK
@@ -469,6 +475,9 @@ struct globals {
 #define text_size      (G.text_size     )
 #define end            (G.end           )
 #define dot            (G.dot           )
+#define gap_size       (G.gap_size      )
+#define gap_tail       (G.gap_tail      )
+#define gap_lines      (G.gap_lines     )
 #define reg            (G.reg           )
 
 #define vi_setops               (G.vi_setops          )
@@ -516,6 +525,9 @@ struct globals {
 #define edit_file__cur_line     (G.edit_file__cur_line)
 #define refresh__old_offset     (G.refresh__old_offset)
 #define format_edit_status__tot (G.format_edit_status__tot)
+#define format_edit_status__cur (G.format_edit_status__cur)
+#define format_edit_status__dot_ofs (G.format_edit_status__dot_ofs)
+#define format_edit_status__end_ofs (G.format_edit_status__end_ofs)
 
 #define YDreg          (G.YDreg         )
 //#define Ureg           (G.Ureg          )
@@ -556,6 +568,7 @@ static int crashme = 0;
 
 static void show_status_line(void);	// put a message on the bottom line
 static void status_line_bold(const char *, ...);
+static void text_gap_close(void);
 
 static void show_help(void)
 {
@@ -762,10 +775,12 @@ static int count_lines(char *start, char *stop)
 	}
 	cnt = 0;
 	stop = end_line(stop);
-	while (start <= stop && start <= end - 1) {
-		start = end_line(start);
-		if (*start == '\n')
-			cnt++;
+	// the status line does this for every key, make it fast
+	while (start <= stop) {
+		start = memchr(start, '\n', stop - start + 1);
+		if (!start)
+			break;
+		cnt++;
 		start++;
 	}
 	return cnt;
@@ -1011,6 +1026,9 @@ static void refresh(int full_screen)
 #endif
 	}
 	sync_cursor(dot, &crow, &ccol);	// where cursor will be (on "dot")
+	// don't show the text parked after the gap as end of file
+	if (gap_size && end_screen() >= end - 1)
+		text_gap_close();
 	tp = screenbegin;	// index into text[] of top line
 
 	// compare text[] to screen[] and mark screen[] lines that need updating
@@ -1265,16 +1283,27 @@ static int format_edit_status(void)
 	// (this will cause a mis-reporting of modified status
 	// once every MAXINT editing operations.)
 
-	// it would be nice to do a similar optimization here -- if
-	// we haven't done a motion that could have changed which line
-	// we're on, then we shouldn't have to do this count_lines()
-	cur = count_lines(text, dot);
+	// count_lines() is expensive on big files, and we are called
+	// several times per keystroke. Recount only if the cursor moved
+	// or something was changed since last time we were here:
+	if (modified_count != last_modified_count
+	 || (size_t)(end - text) != format_edit_status__end_ofs
+	) {
+		format_edit_status__cur = count_lines(text, dot);
+	} else if ((size_t)(dot - text) != format_edit_status__dot_ofs) {
+		// text is the same, only count lines between old and new cursor
+		char *old_dot = text + format_edit_status__dot_ofs;
+		if (dot > old_dot)
+			format_edit_status__cur += count_lines(old_dot, dot) - count_lines(old_dot, old_dot);
+		else
+			format_edit_status__cur -= count_lines(dot, old_dot) - count_lines(dot, dot);
+	}
+	format_edit_status__dot_ofs = dot - text;
+	format_edit_status__end_ofs = end - text;
+	cur = format_edit_status__cur;
 
-	// count_lines() is expensive.
-	// Call it only if something was changed since last time
-	// we were here:
 	if (modified_count != last_modified_count) {
-		tot = cur + count_lines(dot, end - 1) - 1;
+		tot = cur + count_lines(dot, end - 1) - 1 + gap_lines;
 		last_modified_count = modified_count;
 	}
 
@@ -1490,6 +1519,16 @@ static void yank_status(const char *op, const char *p, int cnt)
 static void undo_push(char *, unsigned, int);
 #endif
 
+// bring the text parked by text_gap_open() back to "end"
+static void text_gap_close(void)
+{
+	if (gap_size == 0)
+		return;
+	memmove(end, end + gap_size, gap_tail);
+	end += gap_tail;
+	gap_size = gap_lines = 0;
+}
+
 // open a hole in text[]
 // might reallocate text[]! use p += text_hole_make(p, ...),
 // and be careful to not use pointers into potentially freed text[]!
@@ -1499,8 +1538,12 @@ static uintptr_t text_hole_make(char *p, int size)	// at "p", make a 'size' byte
 
 	if (size <= 0)
 		return bias;
+	if (size >= gap_size)
+		text_gap_close();
 	end += size;		// adjust the new END
-	if (end >= (text + text_size)) {
+	if (gap_size) {
+		gap_size -= size;	// take it from the gap
+	} else if (end >= (text + text_size)) {
 		char *new_text;
 		text_size += end - (text + text_size) + 10240;
 		new_text = xrealloc(text, text_size);
@@ -1516,6 +1559,10 @@ static uintptr_t text_hole_make(char *p, int size)	// at "p", make a 'size' byte
 				if (mark[i])
 					mark[i] += bias;
 		}
+#endif
+#if ENABLE_FEATURE_VI_UNDO_QUEUE
+		if (undo_queue_spos)
+			undo_queue_spos += bias;
 #endif
 		text = new_text;
 	}
@@ -1572,6 +1619,8 @@ static char *text_hole_delete(char *p, char *q, int undo)
 	memmove(dest, src, cnt);
  thd_atend:
 	end = end - hole_size;	// adjust the new END
+	if (gap_size)
+		gap_size += hole_size;
 	if (dest >= end)
 		dest = end - 1;	// make sure dest in below end-1
 	if (end <= text)
@@ -1580,6 +1629,34 @@ static char *text_hole_delete(char *p, char *q, int undo)
 	return dest;
 }
 
+// Inserting or deleting at "dot" moves all the text after it, on every
+// key typed. In insert mode, move the text below the screen away once
+// instead: "end" stops there, text_hole_make() takes room from the gap
+// and text_hole_delete() gives it back, so only what is on screen moves.
+// Everything else sees a shorter text[], do_cmd() closes the gap
+// before any other command and refresh() if the screen gets near it.
+static void text_gap_open(void)
+{
+	char *p;
+	int i, size;
+
+	if (gap_size)
+		return;
+	// the screen shows less than "rows" lines after dot's,
+	// leave as many again for lines joined by backspace
+	p = dot;
+	for (i = rows * 2; i > 0; i--)
+		p = next_line(p);
+	if (p >= end - 1)
+		return;
+	gap_tail = end - p;
+	size = 10240 + gap_tail / 64;
+	p += text_hole_make(p, size);
+	gap_lines = count_lines(p + size, end - 1);
+	gap_size = size;
+	end = p;
+}
+
 #if ENABLE_FEATURE_VI_UNDO
 
 # if ENABLE_FEATURE_VI_UNDO_QUEUE
@@ -2111,6 +2188,64 @@ static size_t indent_len(char *p)
 	return r - p;
 }
 
+// Can 'c' be inserted as is (no autoindent, showmatch etc)?
+static int is_plain_insert_char(int c)
+{
+	if (c < ' ' || c >= 0x7f)
+		return 0;
+#if ENABLE_FEATURE_VI_SETOPTS
+	if (showmatch && strchr(")]}", c) != NULL)
+		return 0;
+#endif
+	return 1;
+}
+
+// Return the next input char if it is already available
+// and is_plain_insert_char(), else -1
+static int get_pending_plain_char(void)
+{
+#if ENABLE_FEATURE_VI_DOT_CMD
+	if (ioq_start != NULL)
+		return -1;
+#endif
+	if (readbuffer[0] == 0) {
+		// read_key() reads one byte at a time, do the same
+		if (!mysleep(0) || safe_read(STDIN_FILENO, readbuffer + 1, 1) != 1)
+			return -1;
+		readbuffer[0] = 1;
+	}
+	if (!is_plain_insert_char((unsigned char)readbuffer[1]))
+		return -1;
+	return get_one_char();
+}
+
+// Insert 'c' and the plain chars already waiting in input after it.
+// Pasted text comes in as such a burst: opening one hole for all of it
+// instead of one per char saves moving the rest of text[] every time.
+static char *plain_run_insert(char *p, char c)
+{
+	char buf[1024];
+	int n = 0, c1;
+
+	buf[n++] = c;
+	while (n < sizeof(buf) && (c1 = get_pending_plain_char()) >= 0)
+		buf[n++] = c1;
+#if ENABLE_FEATURE_VI_UNDO
+	if (n == 1)
+		undo_push_insert(p, 1, ALLOW_UNDO_QUEUED);
+	else {
+		// The queue only takes single chars: a run is an object of its own
+		undo_queue_commit();
+		undo_push_insert(p, n, ALLOW_UNDO);
+	}
+#else
+	modified_count++;
+#endif
+	p += text_hole_make(p, n);
+	memcpy(p, buf, n);
+	return p + n;
+}
+
 #if !ENABLE_FEATURE_VI_UNDO
 #define char_insert(a,b,c) char_insert(a,b)
 #endif
@@ -3720,6 +3855,7 @@ static void do_cmd(int c)
 	}
 
 	if (cmd_mode == 2) {
+		text_gap_close();
 		//  flip-flop Insert/Replace mode
 		if (c == KEYCODE_INSERT)
 			goto dc_i;
@@ -3739,15 +3875,22 @@ static void do_cmd(int c)
 	}
 	if (cmd_mode == 1) {
 		// hitting "Insert" twice means "R" replace mode
-		if (c == KEYCODE_INSERT) goto dc5;
+		if (c == KEYCODE_INSERT) {
+			text_gap_close();
+			goto dc5;
+		}
 		// insert the char c at "dot"
-		if (1 <= c || Isprint(c)) {
+		text_gap_open();
+		if (is_plain_insert_char(c))
+			dot = plain_run_insert(dot, c);
+		else if (1 <= c || Isprint(c)) {
 			dot = char_insert(dot, c, ALLOW_UNDO_QUEUED);
 		}
 		goto dc1;
 	}
 
  key_cmd_mode:
+	text_gap_close();
 	switch (c) {
 		//case 0x01:	// soh
 		//case 0x09:	// ht
@@ -0,0 +1 @@
+cmd_findutils/built-in.o :=  rm -f findutils/built-in.o; ar rcs findutils/built-in.o
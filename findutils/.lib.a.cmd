@@ -0,0 +1 @@
+cmd_findutils/lib.a := rm -f findutils/lib.a; ar  rcs findutils/lib.a findutils/find.o findutils/grep.o findutils/xargs.o
@@ -65,6 +65,25 @@
 //config:	default y
 //config:	depends on XARGS
 //config:
+//config:config FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+//config:	bool "Enable --group and --line-buffer for -P"
+//config:	default y
+//config:	depends on FEATURE_XARGS_SUPPORT_PARALLEL && LONG_OPTS
+//config:	help
+//config:	Support --group: capture stdout and stderr of parallel
+//config:	PROGs through pipes and print them, job by job, in the order
+//config:	jobs were started. --line-buffer prints whole lines
+//config:	as soon as they are complete.
+//config:
+//config:config FEATURE_XARGS_SUPPORT_JOBSERVER
+//config:	bool "Share -P slots with make's jobserver"
+//config:	default y
+//config:	depends on FEATURE_XARGS_SUPPORT_PARALLEL
+//config:	help
+//config:	If MAKEFLAGS contains --jobserver-auth=R,W (or fifo:PATH),
+//config:	take a token from the jobserver before starting each
+//config:	additional parallel PROG, and return it when PROG exits.
+//config:
 //config:config FEATURE_XARGS_SUPPORT_ARGS_FILE
 //config:	bool "Enable -a FILE: use FILE instead of stdin"
 //config:	default y
@@ -102,6 +121,18 @@
 #endif
 
 
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+/* A running (or finished, but not yet printed) child in --group mode */
+struct xargs_job {
+	pid_t pid;     /* 0 after it is reaped */
+	int fd[2];     /* read ends of child's stdout and stderr pipes, -1 at EOF */
+	char *buf[2];  /* captured but not yet printed output */
+	unsigned len[2];
+};
+#define OUT_GROUP   1
+#define OUT_LINEBUF 2
+#endif
+
 struct globals {
 	char **args;
 #if ENABLE_FEATURE_XARGS_SUPPORT_REPL_STR
@@ -116,6 +147,18 @@ struct globals {
 #if ENABLE_FEATURE_XARGS_SUPPORT_PARALLEL
 	int running_procs;
 	int max_procs;
+#endif
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+	struct xargs_job *jobs;
+	int job_cnt;
+	int fd_out[2]; /* our own stdout and stderr */
+	smalluint out_mode;
+#endif
+#if ENABLE_FEATURE_XARGS_SUPPORT_JOBSERVER
+	int js_rfd;
+	int js_wfd;
+	int js_held; /* tokens taken from the jobserver */
+	char js_token;
 #endif
 	smalluint xargs_exitcode;
 #if ENABLE_FEATURE_XARGS_SUPPORT_QUOTES
@@ -137,6 +180,8 @@ struct globals {
 	G.idx = 0; \
 	IF_FEATURE_XARGS_SUPPORT_PARALLEL(G.running_procs = 0;) \
 	IF_FEATURE_XARGS_SUPPORT_PARALLEL(G.max_procs = 1;) \
+	IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP(G.out_mode = 0;) \
+	IF_FEATURE_XARGS_SUPPORT_JOBSERVER(G.js_rfd = -1;) \
 	G.xargs_exitcode = 0; \
 	IF_FEATURE_XARGS_SUPPORT_QUOTES(G.process_stdin__state = NORM;) \
 	IF_FEATURE_XARGS_SUPPORT_QUOTES(G.process_stdin__q = '\0';) \
@@ -156,6 +201,10 @@ enum {
 	IF_FEATURE_XARGS_SUPPORT_ZERO_TERM(   OPTBIT_ZEROTERM   ,)
 	IF_FEATURE_XARGS_SUPPORT_REPL_STR(    OPTBIT_REPLSTR    ,)
 	IF_FEATURE_XARGS_SUPPORT_REPL_STR(    OPTBIT_REPLSTR1   ,)
+	IF_FEATURE_XARGS_SUPPORT_PARALLEL(    OPTBIT_PARALLEL   ,)
+	IF_FEATURE_XARGS_SUPPORT_ARGS_FILE(   OPTBIT_ARGS_FILE  ,)
+	IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP(OPTBIT_GROUP      ,)
+	IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP(OPTBIT_LINEBUF    ,)
 
 	OPT_VERBOSE     = 1 << OPTBIT_VERBOSE    ,
 	OPT_NO_EMPTY    = 1 << OPTBIT_NO_EMPTY   ,
@@ -169,6 +218,8 @@ enum {
 	OPT_ZEROTERM    = IF_FEATURE_XARGS_SUPPORT_ZERO_TERM(   (1 << OPTBIT_ZEROTERM   )) + 0,
 	OPT_REPLSTR     = IF_FEATURE_XARGS_SUPPORT_REPL_STR(    (1 << OPTBIT_REPLSTR    )) + 0,
 	OPT_REPLSTR1    = IF_FEATURE_XARGS_SUPPORT_REPL_STR(    (1 << OPTBIT_REPLSTR1   )) + 0,
+	OPT_GROUP       = IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP((1 << OPTBIT_GROUP      )) + 0,
+	OPT_LINEBUF     = IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP((1 << OPTBIT_LINEBUF    )) + 0,
 };
 #define OPTION_STR "+trn:s:e::E:o" \
 	IF_FEATURE_XARGS_SUPPORT_CONFIRMATION("p") \
@@ -179,6 +230,266 @@ enum {
 	IF_FEATURE_XARGS_SUPPORT_ARGS_FILE(   "a:")
 
 
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+static void write_job_output(struct xargs_job *j, int i, unsigned len)
+{
+	full_write(G.fd_out[i], j->buf[i], len);
+	j->len[i] -= len;
+	memmove(j->buf[i], j->buf[i] + len, j->len[i]);
+}
+
+/* Print and forget finished jobs. In --group mode, only the leading
+ * run of finished jobs is printed: output appears in the order
+ * the jobs were started, even if a later job finishes first.
+ */
+static void flush_jobs(void)
+{
+	int i = 0;
+
+	while (i < G.job_cnt) {
+		struct xargs_job *j = &G.jobs[i];
+		if (j->pid != 0 || j->fd[0] >= 0 || j->fd[1] >= 0) {
+			if (G.out_mode == OUT_GROUP)
+				break;
+			i++;
+			continue;
+		}
+		write_job_output(j, 0, j->len[0]);
+		write_job_output(j, 1, j->len[1]);
+		free(j->buf[0]);
+		free(j->buf[1]);
+		G.job_cnt--;
+		memmove(j, j + 1, (G.job_cnt - i) * sizeof(*j));
+	}
+}
+
+/* Read whatever is available on child's pipe */
+static void read_job_output(struct xargs_job *j, int i)
+{
+	char *buf;
+	int n;
+
+	/* Grow by 4k at once */
+	buf = j->buf[i] = xrealloc(j->buf[i], (j->len[i] | 0xfff) + 1 + 0x1000);
+	n = safe_read(j->fd[i], buf + j->len[i], 0x1000);
+	if (n <= 0) {
+		close(j->fd[i]);
+		j->fd[i] = -1;
+		return;
+	}
+	j->len[i] += n;
+	if (G.out_mode == OUT_LINEBUF) {
+		char *eol = memrchr(buf, '\n', j->len[i]);
+		if (eol)
+			write_job_output(j, i, eol - buf + 1);
+	}
+}
+
+/* In --group/--line-buffer mode, waiting for a child is mostly
+ * waiting for its output: we must keep draining the pipes,
+ * or a chatty child would block forever on a full pipe.
+ * A child is reaped when both its pipes are at EOF.
+ */
+static pid_t group_wait(int *wstat, int block)
+{
+	while (1) {
+		struct pollfd *pfd;
+		pid_t pid;
+		int i, n;
+
+		for (i = 0; i < G.job_cnt; i++) {
+			struct xargs_job *j = &G.jobs[i];
+			if (j->pid != 0 && j->fd[0] < 0 && j->fd[1] < 0) {
+				pid = safe_waitpid(j->pid, wstat, 0);
+				j->pid = 0;
+				flush_jobs();
+				return pid;
+			}
+		}
+
+		/* pfd[i] is G.jobs[i/2].fd[i&1], poll() ignores fds < 0 */
+		pfd = xmalloc(G.job_cnt * 2 * sizeof(pfd[0]));
+		n = 0;
+		for (i = 0; i < G.job_cnt * 2; i++) {
+			pfd[i].fd = G.jobs[i / 2].fd[i & 1];
+			pfd[i].events = POLLIN;
+			pfd[i].revents = 0;
+			n |= (pfd[i].fd >= 0);
+		}
+		if (n == 0) {
+			/* No pipes to watch: children we don't know about,
+			 * or final waitpid() loop is done */
+			free(pfd);
+			return block ? safe_waitpid(-1, wstat, 0) : wait_any_nohang(wstat);
+		}
+		n = safe_poll(pfd, G.job_cnt * 2, block ? -1 : 0);
+		for (i = 0; n > 0 && i < G.job_cnt * 2; i++) {
+			if (pfd[i].revents)
+				read_job_output(&G.jobs[i / 2], i & 1);
+		}
+		free(pfd);
+		if (n <= 0 && !block)
+			return 0;
+	}
+}
+
+static pid_t xargs_spawn(void)
+{
+	struct xargs_job *j;
+	int pipe_out[2], pipe_err[2];
+	pid_t pid;
+
+	if (!G.out_mode)
+		return spawn(G.args);
+
+	xpipe(pipe_out);
+	xpipe(pipe_err);
+	close_on_exec_on(pipe_out[0]);
+	close_on_exec_on(pipe_err[0]);
+	xmove_fd(pipe_out[1], STDOUT_FILENO);
+	xmove_fd(pipe_err[1], STDERR_FILENO);
+	pid = spawn(G.args);
+	/* Restore our own stdout/stderr, keep spawn's errno */
+	{
+		int sv_errno = errno;
+		xdup2(G.fd_out[0], STDOUT_FILENO);
+		xdup2(G.fd_out[1], STDERR_FILENO);
+		errno = sv_errno;
+	}
+	if (pid < 0) {
+		close(pipe_out[0]);
+		close(pipe_err[0]);
+		return pid;
+	}
+
+	/* Grow by 16 elements at once */
+	if (!(G.job_cnt & 0xf))
+		G.jobs = xrealloc(G.jobs, sizeof(G.jobs[0]) * (G.job_cnt + 0x10));
+	j = &G.jobs[G.job_cnt++];
+	j->pid = pid;
+	j->fd[0] = pipe_out[0];
+	j->fd[1] = pipe_err[0];
+	j->buf[0] = j->buf[1] = NULL;
+	j->len[0] = j->len[1] = 0;
+	return pid;
+}
+
+static pid_t xargs_wait(int *wstat, int block)
+{
+	if (G.out_mode)
+		return group_wait(wstat, block);
+	return block ? safe_waitpid(-1, wstat, 0) : wait_any_nohang(wstat);
+}
+#elif ENABLE_FEATURE_XARGS_SUPPORT_PARALLEL
+# define xargs_spawn() spawn(G.args)
+# define xargs_wait(wstat, block) \
+	((block) ? safe_waitpid(-1, (wstat), 0) : wait_any_nohang(wstat))
+#endif
+
+#if ENABLE_FEATURE_XARGS_SUPPORT_JOBSERVER
+/* GNU make passes the jobserver to its children as
+ * MAKEFLAGS="... --jobserver-auth=R,W" (older makes: --jobserver-fds=R,W)
+ * or, since make 4.4, "--jobserver-auth=fifo:PATH".
+ * Every child implicitly owns one token. To run more jobs in parallel,
+ * it reads one byte from R per extra job, and writes it back to W
+ * when that job finishes.
+ */
+static void jobserver_init(void)
+{
+	const char *s = getenv("MAKEFLAGS");
+	const char *auth = NULL;
+
+	while (s && (s = strstr(s, "--jobserver-")) != NULL) {
+		s += sizeof("--jobserver-")-1;
+		if (is_prefixed_with(s, "auth="))
+			auth = s + sizeof("auth=")-1;
+		else if (is_prefixed_with(s, "fds="))
+			auth = s + sizeof("fds=")-1;
+		/* the last one wins */
+	}
+	if (!auth)
+		return;
+
+	if (is_prefixed_with(auth, "fifo:")) {
+		char *path = xstrndup(auth + 5, strcspn(auth + 5, " "));
+		G.js_rfd = G.js_wfd = open(path, O_RDWR | O_CLOEXEC);
+		free(path);
+	} else {
+		char *end;
+		G.js_rfd = bb_strtou(auth, &end, 10);
+		if (*end != ',')
+			G.js_rfd = -1;
+		else
+			G.js_wfd = bb_strtou(end + 1, NULL, 10);
+		/* If make did not consider us a sub-make,
+		 * it did not pass the fds to us: */
+		if (G.js_rfd >= 0
+		 && (fcntl(G.js_rfd, F_GETFD) < 0 || fcntl(G.js_wfd, F_GETFD) < 0)
+		) {
+			G.js_rfd = -1;
+		}
+	}
+	if (G.js_rfd < 0)
+		return;
+	G.js_held = 0;
+	G.js_token = '+';
+}
+
+/* Can we start one more child without blocking? */
+static int jobserver_ready(void)
+{
+	struct pollfd pfd;
+
+	if (G.js_rfd < 0 || G.running_procs == 0)
+		return 1; /* the first child runs on our own token */
+	pfd.fd = G.js_rfd;
+	pfd.events = POLLIN;
+	return poll(&pfd, 1, 0) > 0;
+}
+
+static void jobserver_get_token(void)
+{
+	if (G.js_rfd < 0 || G.running_procs == 0)
+		return;
+	/* Another make may have grabbed it since jobserver_ready(),
+	 * then this blocks until someone returns a token */
+	if (safe_read(G.js_rfd, &G.js_token, 1) == 1)
+		G.js_held++;
+}
+
+/* Keep js_held == running_procs - 1 */
+static void jobserver_put_token(void)
+{
+	if (G.js_held != 0 && G.js_held >= G.running_procs) {
+		full_write(G.js_wfd, &G.js_token, 1);
+		G.js_held--;
+	}
+}
+#else
+# define jobserver_init()      ((void)0)
+# define jobserver_ready()     1
+# define jobserver_get_token() ((void)0)
+# define jobserver_put_token() ((void)0)
+#endif
+
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+/* Bailing out (bad exit status, or dying): wait for the jobs
+ * still running, so that nothing buffered for them is lost.
+ */
+static void group_finish(void)
+{
+	int wstat;
+
+	die_func = NULL; /* in case we die in here */
+	while (G.job_cnt != 0) {
+		if (group_wait(&wstat, 1) > 0 && G.running_procs != 0) {
+			G.running_procs--;
+			jobserver_put_token();
+		}
+	}
+}
+#endif
+
 /*
  * Returns 0 if xargs should continue (but may set G.xargs_exitcode to 123).
  * Else sets G.xargs_exitcode to error code and returns nonzero.
@@ -201,17 +512,19 @@ static int xargs_exec(void)
 		pid_t pid;
 		int wstat;
  again:
-		if (G.running_procs >= G.max_procs)
-			pid = safe_waitpid(-1, &wstat, 0);
+		if (G.running_procs >= G.max_procs || !jobserver_ready())
+			pid = xargs_wait(&wstat, 1);
 		else
-			pid = wait_any_nohang(&wstat);
+			pid = xargs_wait(&wstat, 0);
 		if (pid > 0) {
 			/* We may have children we don't know about:
 			 * sh -c 'sleep 1 & exec xargs ...'
 			 * Do not make G.running_procs go negative.
 			 */
-			if (G.running_procs != 0)
+			if (G.running_procs != 0) {
 				G.running_procs--;
+				jobserver_put_token();
+			}
 			status = WIFSIGNALED(wstat)
 				? 0x180 + WTERMSIG(wstat)
 				: WEXITSTATUS(wstat);
@@ -227,13 +540,16 @@ static int xargs_exec(void)
 			/* Not in final waitpid() loop,
 			 * and G.running_procs < G.max_procs: start more procs
 			 */
-			status = spawn(G.args);
+			jobserver_get_token();
+			status = xargs_spawn();
 			/* here "status" actually holds pid, or -1 */
 			if (status > 0) {
 				G.running_procs++;
 				status = 0;
+			} else {
+				/* status == -1 (failed to fork or exec) */
+				jobserver_put_token();
 			}
-			/* else: status == -1 (failed to fork or exec) */
 		} else {
 			/* final waitpid() loop: must be ECHILD "no more children" */
 			status = 0;
@@ -276,8 +592,13 @@ static int xargs_exec(void)
 		status = 0;
 	}
  ret:
-	if (status != 0)
+	if (status != 0) {
 		G.xargs_exitcode = status;
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+		if (G.out_mode)
+			group_finish();
+#endif
+	}
 	if (option_mask32 & OPT_STDIN_TTY)
 		xdup2(G.fd_stdin, STDIN_FILENO);
 	return status;
@@ -598,7 +919,12 @@ static int xargs_ask_confirmation(void)
 //usage:     "\n	-n N	Pass no more than N args to PROG"
 //usage:     "\n	-s N	Pass command line of no more than N bytes"
 //usage:	IF_FEATURE_XARGS_SUPPORT_PARALLEL(
-//usage:     "\n	-P N	Run up to N PROGs in parallel"
+//usage:     "\n	-P N	Run up to N PROGs in parallel (0: one per CPU)"
+//usage:	)
+//usage:	IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP(
+//usage:     "\n	--group	With -P, print each PROG's output when it exits,"
+//usage:     "\n		in the order PROGs were started"
+//usage:     "\n	--line-buffer	With -P, print each PROG's output by whole lines"
 //usage:	)
 //usage:	IF_FEATURE_XARGS_SUPPORT_TERMOPT(
 //usage:     "\n	-x	Exit if size is exceeded"
@@ -629,7 +955,11 @@ int xargs_main(int argc UNUSED_PARAM, char **argv)
 	INIT_G();
 
 	opt = getopt32long(argv, OPTION_STR,
-		"no-run-if-empty\0" No_argument "r",
+		"no-run-if-empty\0" No_argument "r"
+		IF_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP(
+		"group\0"           No_argument "\xff"
+		"line-buffer\0"     No_argument "\xfe"
+		),
 		&max_args, &max_chars, &G.eof_str, &G.eof_str
 		IF_FEATURE_XARGS_SUPPORT_REPL_STR(, &G.repl_str, &G.repl_str)
 		IF_FEATURE_XARGS_SUPPORT_PARALLEL(, &G.max_procs)
@@ -637,8 +967,28 @@ int xargs_main(int argc UNUSED_PARAM, char **argv)
 	);
 
 #if ENABLE_FEATURE_XARGS_SUPPORT_PARALLEL
-	if (G.max_procs <= 0) /* -P0 means "run lots of them" */
-		G.max_procs = 100; /* let's not go crazy high */
+	if (G.max_procs <= 0) { /* -P0 means "one per CPU" */
+		G.max_procs = get_cpu_count();
+		if (G.max_procs == 0) /* non-SMP kernel */
+			G.max_procs = 1;
+	}
+	if (G.max_procs != 1)
+		jobserver_init();
+#endif
+#if ENABLE_FEATURE_XARGS_SUPPORT_OUTPUT_GROUP
+	if ((opt & (OPT_GROUP | OPT_LINEBUF)) && G.max_procs != 1) {
+		G.out_mode = (opt & OPT_LINEBUF) ? OUT_LINEBUF : OUT_GROUP;
+		G.jobs = NULL;
+		G.job_cnt = 0;
+		G.fd_out[0] = dup(STDOUT_FILENO);
+		G.fd_out[1] = dup(STDERR_FILENO);
+		if (G.fd_out[0] < 0 || G.fd_out[1] < 0)
+			bb_simple_perror_msg_and_die("dup");
+		close_on_exec_on(G.fd_out[0]);
+		close_on_exec_on(G.fd_out[1]);
+		/* Don't lose buffered output if we die */
+		die_func = group_finish;
+	}
 #endif
 
 #if ENABLE_FEATURE_XARGS_SUPPORT_ARGS_FILE
@@ -956,6 +956,31 @@ typedef struct uni_stat_t {
  * SUBST_WCHAR. This function is unicode-aware. */
 const char* FAST_FUNC printable_string(const char *str);
 const char* FAST_FUNC printable_string2(uni_stat_t *stats, const char *str);
+/* Print str to stdout as a quoted JSON string */
+void print_json_string(const char *str) FAST_FUNC;
+/* Block scanning kernels (vectorized where possible) for wc, tr, cmp */
+struct text_counts {
+	unsigned long long lines;
+	unsigned long long words;
+	unsigned long long chars; /* bytes which are not UTF-8 continuation bytes */
+	smallint in_word;
+};
+size_t count_byte(const void *buf, size_t len, int c) FAST_FUNC;
+void count_text(struct text_counts *tc, const void *buf, size_t len) FAST_FUNC;
+void translate_bytes(void *dst, const void *src, size_t len, const unsigned char *map) FAST_FUNC;
+/* Sequential reads of (possibly huge) files in large blocks,
+ * telling the kernel to read ahead. cmp, md5sum etc use this.
+ */
+#define BULK_READ_SIZE (CONFIG_FEATURE_COPYBUF_KB > 256 ? CONFIG_FEATURE_COPYBUF_KB * 1024 : 256 * 1024)
+typedef struct bulk_reader_t {
+	int fd;
+	smallint hint;
+	off_t offset;
+} bulk_reader_t;
+void bulk_reader_init(bulk_reader_t *br, int fd) FAST_FUNC;
+ssize_t bulk_read(bulk_reader_t *br, void *buf, size_t len) FAST_FUNC;
+void *xmalloc_bulk_buf(void) FAST_FUNC;
+
 /* Prints unprintable char ch as ^C or M-c to file
  * (M-c is used only if ch is ORed with PRINTABLE_META),
  * else it is printed as-is (except for ch = 0x9b) */
@@ -2132,6 +2157,8 @@ enum {
 	PSSCAN_NICE     = (1 << 20) * ENABLE_FEATURE_PS_ADDITIONAL_COLUMNS,
 	PSSCAN_RUIDGID  = (1 << 21) * ENABLE_FEATURE_PS_ADDITIONAL_COLUMNS,
 	PSSCAN_TASKS	= (1 << 22) * ENABLE_FEATURE_SHOW_THREADS,
+	/* Keep /proc/PID/stat open for the next scan (used by top) */
+	PSSCAN_KEEP_FDS = (1 << 23) * ENABLE_FEATURE_PROCPS_KEEP_FDS,
 };
 //procps_status_t* alloc_procps_scan(void) FAST_FUNC;
 void free_procps_scan(procps_status_t* sp) FAST_FUNC;
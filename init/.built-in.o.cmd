@@ -0,0 +1 @@
+cmd_init/built-in.o :=  rm -f init/built-in.o; ar rcs init/built-in.o
@@ -0,0 +1 @@
+cmd_init/lib.a := rm -f init/lib.a; ar  rcs init/lib.a init/bootchartd.o init/halt.o init/init.o
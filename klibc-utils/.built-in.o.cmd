@@ -0,0 +1 @@
+cmd_klibc-utils/built-in.o :=  rm -f klibc-utils/built-in.o; ar rcs klibc-utils/built-in.o
@@ -0,0 +1 @@
+cmd_klibc-utils/lib.a := rm -f klibc-utils/lib.a; ar  rcs klibc-utils/lib.a klibc-utils/resume.o
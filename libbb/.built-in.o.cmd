@@ -0,0 +1 @@
+cmd_libbb/built-in.o :=  rm -f libbb/built-in.o; ar rcs libbb/built-in.o
@@ -0,0 +1 @@
+cmd_libbb/lib.a := rm -f libbb/lib.a; ar  rcs libbb/lib.a libbb/alloc_affinity.o libbb/appletlib.o libbb/ask_confirmation.o libbb/auto_string.o libbb/bb_askpass.o libbb/bb_bswap_64.o libbb/bb_cat.o libbb/bb_do_delay.o libbb/bb_getgroups.o libbb/bb_getsockname.o libbb/bb_pwd.o libbb/bb_qsort.o libbb/bb_strtonum.o libbb/bytescan.o libbb/capability.o libbb/change_identity.o libbb/chomp.o libbb/common_bufsiz.o libbb/compare_string_array.o libbb/concat_path_file.o libbb/concat_subpath_file.o libbb/const_hack.o libbb/copy_file.o libbb/copyfd.o libbb/correct_password.o libbb/crc32.o libbb/default_error_retval.o libbb/device_open.o libbb/dump.o libbb/duration.o libbb/endofname.o libbb/executable.o libbb/fclose_nonstdin.o libbb/fflush_stdout_and_exit.o libbb/fgets_str.o libbb/find_mount_point.o libbb/find_pid_by_name.o libbb/find_root_device.o libbb/full_write.o libbb/get_console.o libbb/get_cpu_count.o libbb/get_last_path_component.o libbb/get_line_from_file.o libbb/get_shell_name.o libbb/get_volsize.o libbb/getopt32.o libbb/getopt_allopts.o libbb/getpty.o libbb/hash_md5_sha.o libbb/hash_sha1_hwaccel_x86-32.o libbb/hash_sha1_hwaccel_x86-64.o libbb/hash_sha1_x86-64.o libbb/hash_sha256_hwaccel_x86-32.o libbb/hash_sha256_hwaccel_x86-64.o libbb/herror_msg.o libbb/human_readable.o libbb/in_ether.o libbb/inet_cksum.o libbb/inet_common.o libbb/inode_hash.o libbb/isdirectory.o libbb/isqrt.o libbb/iterate_on_dir.o libbb/kernel_version.o libbb/last_char_is.o libbb/lineedit.o libbb/lineedit_ptr_hack.o libbb/llist.o libbb/logenv.o libbb/login.o libbb/loop.o libbb/make_directory.o libbb/makedev.o libbb/match_fstype.o libbb/messages.o libbb/missing_syscalls.o libbb/mode_string.o libbb/nuke_str.o libbb/obscure.o libbb/parse_config.o libbb/parse_mode.o libbb/percent_decode.o libbb/perror_msg.o libbb/perror_nomsg.o libbb/perror_nomsg_and_die.o libbb/pidfile.o libbb/platform.o libbb/popcnt.o libbb/print_flags.o libbb/print_json_string.o libbb/print_numbered_lines.o libbb/printable.o libbb/printable_string.o libbb/process_escape_sequence.o libbb/procps.o libbb/progress.o libbb/ptr_to_globals.o libbb/pw_encrypt.o libbb/read.o libbb/read_bulk.o libbb/read_key.o libbb/read_printf.o libbb/recursive_action.o libbb/remove_file.o libbb/replace.o libbb/rtc.o libbb/run_shell.o libbb/safe_gethostname.o libbb/safe_poll.o libbb/safe_strncpy.o libbb/safe_write.o libbb/securetty.o libbb/setup_environment.o libbb/signals.o libbb/simplify_path.o libbb/single_argv.o libbb/skip_whitespace.o libbb/speed_table.o libbb/str_tolower.o libbb/strrstr.o libbb/sysconf.o libbb/time.o libbb/trim.o libbb/u_signal_names.o libbb/ubi.o libbb/udp_io.o libbb/unicode.o libbb/update_passwd.o libbb/utmp.o libbb/uuencode.o libbb/verror_msg.o libbb/vfork_daemon_rexec.o libbb/warn_ignoring_args.o libbb/wfopen.o libbb/wfopen_input.o libbb/write.o libbb/xatonum.o libbb/xconnect.o libbb/xfunc_die.o libbb/xfuncs.o libbb/xfuncs_printf.o libbb/xgetcwd.o libbb/xgethostbyname.o libbb/xreadlink.o libbb/xrealloc_vector.o libbb/xregcomp.o
@@ -0,0 +1,316 @@
+/* vi: set sw=4 ts=4: */
+/*
+ * Utility routines.
+ *
+ * Block scanning kernels for wc, tr and cmp.
+ *
+ * Licensed under GPLv2, see file LICENSE in this source tree.
+ */
+//kbuild:lib-$(CONFIG_WC) += bytescan.o
+//kbuild:lib-$(CONFIG_TR) += bytescan.o
+//kbuild:lib-$(CONFIG_CMP) += bytescan.o
+
+#include "libbb.h"
+
+/* The counting kernels are written with gcc vector extensions:
+ * the same source becomes SSE2 on x86-64, NEON on ARM, and is compiled
+ * a second time for AVX2 on x86-64 (selected at runtime).
+ * Other compilers and targets use the plain loops.
+ */
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+# define BYTESCAN_VECTORS 1
+typedef unsigned char bvec_t __attribute__((vector_size(32)));
+typedef unsigned long long qvec_t __attribute__((vector_size(32)));
+# define BVEC_LEN ((int)sizeof(bvec_t))
+# define BVEC_LOAD(v, p) memcpy(&(v), (p), sizeof(v))
+#else
+# define BYTESCAN_VECTORS 0
+#endif
+
+#if BYTESCAN_VECTORS && defined(__x86_64__)
+# include <immintrin.h>
+# define BYTESCAN_AVX2 1
+# define AVX2_FUNC __attribute__((target("avx2")))
+static smallint have_avx2;
+static NOINLINE int get_avx2(void)
+{
+	__builtin_cpu_init();
+	have_avx2 = __builtin_cpu_supports("avx2") ? 1 : -1;
+	return have_avx2;
+}
+static ALWAYS_INLINE int use_avx2(void)
+{
+	int r = have_avx2;
+	if (!r)
+		r = get_avx2();
+	return r > 0;
+}
+#else
+# define BYTESCAN_AVX2 0
+#endif
+
+/* wc's notion of a word: a run of [!-~] ended by ' ' or [\t-\r].
+ * Other bytes (controls, DEL, >= 0x80) neither start nor end a word.
+ */
+#define IS_WORD_CHAR(c) ((unsigned char)((c) - 0x21) < 0x7f - 0x21)
+#define IS_WORD_SEP(c)  ((c) == ' ' || (unsigned char)((c) - '\t') <= '\r' - '\t')
+
+static void count_text_scalar(struct text_counts *tc, const unsigned char *p, size_t len)
+{
+	unsigned long long lines = 0, words = 0, chars = 0;
+	smallint in_word = tc->in_word;
+
+	while (len != 0) {
+		unsigned char c = *p++;
+		len--;
+		lines += (c == '\n');
+		chars += ((c & 0xc0) != 0x80);
+		if (IS_WORD_CHAR(c)) {
+			in_word = 1;
+		} else if (IS_WORD_SEP(c)) {
+			words += in_word;
+			in_word = 0;
+		}
+	}
+	tc->lines += lines;
+	tc->words += words;
+	tc->chars += chars;
+	tc->in_word = in_word;
+}
+
+#if BYTESCAN_VECTORS
+static ALWAYS_INLINE unsigned hsum_bvec(const bvec_t *acc)
+{
+	unsigned sum = 0;
+	int i;
+	for (i = 0; i < BVEC_LEN; i++)
+		sum += (*acc)[i];
+	return sum;
+}
+
+/* Byte counters in the vector lanes overflow after 255 steps */
+# define MAX_STEPS 255
+
+static ALWAYS_INLINE size_t count_byte_vec(const unsigned char *p, size_t len, unsigned char c)
+{
+	size_t cnt = 0;
+
+	while (len >= BVEC_LEN) {
+		bvec_t acc = {};
+		size_t steps = len / BVEC_LEN;
+		if (steps > MAX_STEPS)
+			steps = MAX_STEPS;
+		len -= steps * BVEC_LEN;
+		do {
+			bvec_t v;
+			BVEC_LOAD(v, p);
+			acc -= (bvec_t)(v == c);
+			p += BVEC_LEN;
+		} while (--steps);
+		cnt += hsum_bvec(&acc);
+	}
+	while (len != 0) {
+		cnt += (*p++ == c);
+		len--;
+	}
+	return cnt;
+}
+
+/* Vectors which contain only word chars and separators are counted
+ * in parallel: a word ends wherever a separator follows a word char.
+ * A vector with any other byte goes through the scalar loop, since
+ * those bytes make the word state depend on everything before them.
+ * p[-1] must be readable.
+ */
+static ALWAYS_INLINE void count_text_vec(struct text_counts *tc, const unsigned char *p, size_t len)
+{
+	smallint in_word = tc->in_word;
+
+	while (len >= BVEC_LEN) {
+		bvec_t lines_acc = {}, words_acc = {}, chars_acc = {};
+		size_t steps = len / BVEC_LEN;
+		if (steps > MAX_STEPS)
+			steps = MAX_STEPS;
+		len -= steps * BVEC_LEN;
+		do {
+			bvec_t v, prev, word, sep, other;
+			qvec_t q;
+
+			BVEC_LOAD(v, p);
+			word = (bvec_t)((bvec_t)(v - 0x21) < 0x7f - 0x21);
+			sep = (bvec_t)((v == ' ') | ((bvec_t)(v - '\t') <= '\r' - '\t'));
+			other = ~(word | sep);
+			q = (qvec_t)other;
+			if (q[0] | q[1] | q[2] | q[3]) {
+				tc->in_word = in_word;
+				count_text_scalar(tc, p, BVEC_LEN);
+				in_word = tc->in_word;
+				p += BVEC_LEN;
+				continue;
+			}
+			/* p[-1] may be an "other" byte which kept in_word set */
+			if (in_word && !IS_WORD_CHAR(p[-1]) && IS_WORD_SEP(p[0]))
+				tc->words++;
+			BVEC_LOAD(prev, p - 1);
+			prev = (bvec_t)((bvec_t)(prev - 0x21) < 0x7f - 0x21);
+			words_acc -= sep & prev;
+			lines_acc -= (bvec_t)(v == '\n');
+			chars_acc -= (bvec_t)((v & 0xc0) != 0x80);
+			in_word = word[BVEC_LEN - 1] & 1;
+			p += BVEC_LEN;
+		} while (--steps);
+		tc->lines += hsum_bvec(&lines_acc);
+		tc->words += hsum_bvec(&words_acc);
+		tc->chars += hsum_bvec(&chars_acc);
+	}
+	tc->in_word = in_word;
+	count_text_scalar(tc, p, len);
+}
+
+# if BYTESCAN_AVX2
+static AVX2_FUNC NOINLINE size_t count_byte_avx2(const unsigned char *p, size_t len, unsigned char c)
+{
+	return count_byte_vec(p, len, c);
+}
+static AVX2_FUNC NOINLINE void count_text_avx2(struct text_counts *tc, const unsigned char *p, size_t len)
+{
+	count_text_vec(tc, p, len);
+}
+# endif
+#endif /* BYTESCAN_VECTORS */
+
+/* Count occurrences of byte c, e.g. for wc -l */
+size_t FAST_FUNC count_byte(const void *buf, size_t len, int c)
+{
+#if BYTESCAN_VECTORS
+# if BYTESCAN_AVX2
+	if (use_avx2())
+		return count_byte_avx2(buf, len, c);
+# endif
+	return count_byte_vec(buf, len, c);
+#else
+	const unsigned char *p = buf;
+	size_t cnt = 0;
+	while (len != 0) {
+		cnt += (*p++ == (unsigned char)c);
+		len--;
+	}
+	return cnt;
+#endif
+}
+
+/* Add lines, words and chars (bytes which are not UTF-8 continuation bytes)
+ * in buf to tc. tc->in_word carries the word state between calls.
+ */
+void FAST_FUNC count_text(struct text_counts *tc, const void *buf, size_t len)
+{
+#if BYTESCAN_VECTORS
+	const unsigned char *p = buf;
+
+	if (len < BVEC_LEN + 1) {
+		count_text_scalar(tc, p, len);
+		return;
+	}
+	/* the vector loop looks at p[-1] */
+	count_text_scalar(tc, p, 1);
+# if BYTESCAN_AVX2
+	if (use_avx2()) {
+		count_text_avx2(tc, p + 1, len - 1);
+		return;
+	}
+# endif
+	count_text_vec(tc, p + 1, len - 1);
+#else
+	count_text_scalar(tc, buf, len);
+#endif
+}
+
+#if BYTESCAN_AVX2
+/* pshufb looks up 16 entries at a time, indexed by the low nibble.
+ * Only the 16-byte rows of the map which are not identity need a lookup:
+ * "tr a-z A-Z" touches two of them.
+ */
+static AVX2_FUNC NOINLINE size_t translate_avx2(unsigned char *dst,
+		const unsigned char *src, size_t len,
+		const unsigned char *map, unsigned rows)
+{
+	__m256i lut[16];
+	__m256i hi_sel[16];
+	const __m256i low4 = _mm256_set1_epi8(0x0f);
+	unsigned nrows = 0;
+	size_t i;
+
+	while (rows) {
+		unsigned r = __builtin_ctz(rows);
+		__m128i t = _mm_loadu_si128((const void *)(map + r * 16));
+		lut[nrows] = _mm256_broadcastsi128_si256(t);
+		hi_sel[nrows] = _mm256_set1_epi8(r);
+		nrows++;
+		rows &= rows - 1;
+	}
+
+	for (i = 0; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const void *)(src + i));
+		__m256i lo = _mm256_and_si256(v, low4);
+		__m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low4);
+		unsigned k;
+		for (k = 0; k < nrows; k++) {
+			__m256i m = _mm256_cmpeq_epi8(hi, hi_sel[k]);
+			/* not blendv: with -funsigned-char, gcc folds it wrong */
+			v = _mm256_or_si256(_mm256_andnot_si256(m, v),
+				_mm256_and_si256(m, _mm256_shuffle_epi8(lut[k], lo)));
+		}
+		_mm256_storeu_si256((void *)(dst + i), v);
+	}
+	return i;
+}
+#endif
+
+/* dst[i] = map[src[i]]. dst may be equal to src */
+void FAST_FUNC translate_bytes(void *dst, const void *src, size_t len, const unsigned char *map)
+{
+	unsigned char *d = dst;
+	const unsigned char *s = src;
+	unsigned rows = 0;
+	unsigned r;
+
+	for (r = 0; r < 16; r++) {
+		unsigned k;
+		for (k = 0; k < 16; k++) {
+			if (map[r * 16 + k] != r * 16 + k) {
+				rows |= 1 << r;
+				break;
+			}
+		}
+	}
+	if (!rows) {
+		if (d != s)
+			memcpy(d, s, len);
+		return;
+	}
+#if BYTESCAN_AVX2
+	if (use_avx2()) {
+		size_t done = translate_avx2(d, s, len, map, rows);
+		d += done;
+		s += done;
+		len -= done;
+	}
+#endif
+	while (len >= 4) {
+		unsigned char c0 = map[s[0]];
+		unsigned char c1 = map[s[1]];
+		unsigned char c2 = map[s[2]];
+		unsigned char c3 = map[s[3]];
+		d[0] = c0;
+		d[1] = c1;
+		d[2] = c2;
+		d[3] = c3;
+		d += 4;
+		s += 4;
+		len -= 4;
+	}
+	while (len != 0) {
+		*d++ = map[*s++];
+		len--;
+	}
+}
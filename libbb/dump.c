@@ -27,6 +27,17 @@
 #define	F_UINT		0x200		/* %[ouXx] */
 #define	F_TEXT		0x400		/* no conversions */
 
+/* A field of display_fast()'s output template, filled in for every block */
+struct hole {
+	unsigned pos;            /* in the template */
+	unsigned ofs;            /* byte in the block (address: added to block address) */
+	unsigned char width;
+	unsigned char bcnt;      /* 1, 2, 4; 0: address, 0xff: %_p */
+	unsigned char base;      /* 8, 10, 16 */
+	char pad;                /* '0' or ' ' */
+	char xcase;              /* 0x20: lowercase hex digits */
+};
+
 typedef struct priv_dumper_t {
 	dumper_t pub;
 
@@ -42,6 +53,13 @@ typedef struct priv_dumper_t {
 	smallint get__ateof; // = 1;
 	unsigned char *get__curp;
 	unsigned char *get__savp;
+
+	/* display_fast() */
+	char *tmpl;
+	unsigned tmpl_len;
+	unsigned nholes;
+	struct hole *holes;
+	char *fast_buf;
 } priv_dumper_t;
 
 static const char dot_flags_width_chars[] ALIGN1 = ".#-+ 0123456789";
@@ -539,6 +557,237 @@ static void conv_u(PR *pr, unsigned char *p)
 	}
 }
 
+/* Most formats (hexdump -C and the like, xxd) print every full block
+ * the same way except for the values. Such formats are "compiled" into
+ * a template of one block's output, with holes for the values, which are
+ * filled in by hand instead of calling printf for every unit.
+ * Formats with anything else, as well as the last partial block,
+ * go through the generic code in display().
+ */
+static unsigned max_digits(unsigned bcnt, unsigned base)
+{
+	/* bcnt: 1, 2, 4 */
+	static const uint8_t digits[3][3] = {
+		/*  8  10  16 */
+		{  3,  3,  2 },
+		{  6,  5,  4 },
+		{ 11, 10,  8 },
+	};
+	return digits[bcnt >> 1][base == 8 ? 0 : base == 10 ? 1 : 2];
+}
+
+static int add_text(priv_dumper_t *dumper, const char *text, const char *end)
+{
+	unsigned len = end - text;
+
+	if (memchr(text, '%', len))
+		return 0; /* "%%" */
+	dumper->tmpl = xrealloc(dumper->tmpl, dumper->tmpl_len + len + 1);
+	memcpy(dumper->tmpl + dumper->tmpl_len, text, len);
+	dumper->tmpl_len += len;
+	return 1;
+}
+
+/* Add "TEXT%[0][WIDTH][.PREC][ll]CONVTEXT" (ending at end) to the template */
+static int add_conv(priv_dumper_t *dumper, PR *pr, unsigned ofs, const char *end)
+{
+	const char *fmt = pr->fmt;
+	const char *pct = strchr(fmt, '%');
+	struct hole *h;
+	unsigned width, prec;
+	char pad = ' ';
+	char c;
+
+	if (!add_text(dumper, fmt, pct))
+		return 0;
+	fmt = pct + 1;
+	if (*fmt == '0') {
+		pad = '0';
+		fmt++;
+	}
+	width = 0;
+	while (isdigit(*fmt))
+		width = width * 10 + (*fmt++ - '0');
+	if (*fmt == '.') {
+		prec = 0;
+		while (isdigit(*++fmt))
+			prec = prec * 10 + (*fmt - '0');
+		if (prec < width)
+			return 0; /* e.g. "%8.4x": mixed padding */
+		width = prec;
+		pad = '0';
+	}
+	if (pr->flags == F_ADDRESS) {
+		if (fmt[0] != 'l' || fmt[1] != 'l')
+			return 0;
+		fmt += 2;
+	}
+	c = *fmt++;
+
+	dumper->holes = xrealloc_vector(dumper->holes, 4, dumper->nholes);
+	h = &dumper->holes[dumper->nholes++];
+	h->pos = dumper->tmpl_len;
+	h->ofs = ofs;
+	h->pad = pad;
+	h->xcase = 0x20;
+	h->base = 16;
+	if (c == 'X')
+		h->xcase = 0;
+	else if (c == 'o')
+		h->base = 8;
+	else if (c == 'u' || c == 'd')
+		h->base = 10;
+	else if (c != 'x' && c != 'c')
+		return 0;
+
+	switch (pr->flags) {
+	case F_ADDRESS:
+		/* address may still outgrow the width, checked for every block */
+		if (c == 'c' || width == 0)
+			return 0;
+		h->bcnt = 0;
+		break;
+	case F_P:
+		if (width > 1)
+			return 0;
+		width = 1;
+		h->bcnt = 0xff;
+		break;
+	default: /* F_UINT */
+		if (c == 'd' || c == 'c' || pr->bcnt > 4)
+			return 0;
+		/* values must never be wider than the field */
+		if (width < max_digits(pr->bcnt, h->base))
+			return 0;
+		h->bcnt = pr->bcnt;
+		break;
+	}
+	if (width > 32)
+		return 0;
+	h->width = width;
+	dumper->tmpl = xrealloc(dumper->tmpl, dumper->tmpl_len + width + 1);
+	memset(dumper->tmpl + dumper->tmpl_len, ' ', width);
+	dumper->tmpl_len += width;
+
+	return add_text(dumper, fmt, end);
+}
+
+static NOINLINE void compile_fast(priv_dumper_t *dumper)
+{
+	FS *fs;
+
+	for (fs = dumper->pub.fshead; fs; fs = fs->nextfs) {
+		FU *fu;
+		unsigned ofs = 0;
+
+		for (fu = fs->nextfu; fu; fu = fu->nextfu) {
+			int cnt;
+
+			if (fu->flags & F_IGNORE)
+				break;
+			for (cnt = fu->reps; cnt; --cnt) {
+				PR *pr;
+
+				for (pr = fu->nextpr; pr; ofs += pr->bcnt, pr = pr->nextpr) {
+					const char *end = pr->fmt + strlen(pr->fmt);
+
+					if (cnt == 1 && pr->nospace)
+						end = pr->nospace;
+					if (pr->flags == F_TEXT) {
+						if (!add_text(dumper, pr->fmt, end))
+							goto fail;
+						continue;
+					}
+					if (!(pr->flags & (F_ADDRESS | F_P | F_UINT))
+					 || !add_conv(dumper, pr, ofs, end)
+					) {
+						goto fail;
+					}
+				}
+			}
+		}
+	}
+	if (dumper->tmpl_len != 0) {
+		dumper->fast_buf = xmalloc(dumper->tmpl_len);
+		return;
+	}
+ fail:
+	free(dumper->tmpl);
+	free(dumper->holes);
+	dumper->tmpl = NULL;
+	dumper->holes = NULL;
+}
+
+/* Returns 0 if the block can't be done here (address is too wide) */
+static int display_fast(priv_dumper_t *dumper, const unsigned char *bp)
+{
+	char *out = dumper->fast_buf;
+	const struct hole *h = dumper->holes;
+	const struct hole *end = h + dumper->nholes;
+
+	memcpy(out, dumper->tmpl, dumper->tmpl_len);
+	for (; h != end; h++) {
+		char *p = out + h->pos;
+		char *q;
+		unsigned long long v;
+
+		if (h->bcnt == 1 && h->base == 16 && h->width == 2) {
+			/* the most popular one: %02x */
+			unsigned c = bp[h->ofs];
+			p[0] = bb_hexdigits_upcase[c >> 4] | h->xcase;
+			p[1] = bb_hexdigits_upcase[c & 0xf] | h->xcase;
+			continue;
+		}
+		switch (h->bcnt) {
+		case 0xff:
+			v = bp[h->ofs];
+			*p = isprint_asciionly(v) ? v : '.';
+			continue;
+		case 0:
+			v = (unsigned long long)dumper->pub.address + h->ofs
+#if ENABLE_XXD
+				+ dumper->pub.xxd_displayoff
+#endif
+			;
+			break;
+		case 1:
+			v = bp[h->ofs];
+			break;
+		case 2: {
+			uint16_t v16;
+			move_from_unaligned16(v16, bp + h->ofs);
+			v = v16;
+			break;
+		}
+		default: {
+			uint32_t v32;
+			move_from_unaligned32(v32, bp + h->ofs);
+			v = v32;
+			break;
+		}
+		}
+		q = p + h->width;
+		if (h->base == 10) {
+			do {
+				*--q = '0' + v % 10;
+				v /= 10;
+			} while (v && q != p);
+		} else {
+			unsigned shift = h->base == 16 ? 4 : 3;
+			do {
+				*--q = bb_hexdigits_upcase[v & (h->base - 1)] | h->xcase;
+				v >>= shift;
+			} while (v && q != p);
+		}
+		if (v)
+			return 0; /* address does not fit */
+		while (q != p)
+			*--q = h->pad;
+	}
+	fwrite(out, 1, dumper->tmpl_len, stdout);
+	return 1;
+}
+
 static NOINLINE void display(priv_dumper_t* dumper)
 {
 	unsigned char *bp;
@@ -548,6 +797,13 @@ static NOINLINE void display(priv_dumper_t* dumper)
 		unsigned char *savebp;
 		off_t saveaddress;
 
+		if (dumper->tmpl
+		 && (!dumper->eaddress || dumper->pub.address + dumper->blocksize <= dumper->eaddress)
+		 && display_fast(dumper, bp)
+		) {
+			continue;
+		}
+
 		fs = dumper->pub.fshead;
 		savebp = bp;
 		saveaddress = dumper->pub.address;
@@ -742,6 +998,8 @@ int FAST_FUNC bb_dump_dump(dumper_t *pub_dumper, char **argv)
 		rewrite(dumper, tfs);
 	}
 
+	compile_fast(dumper);
+
 	dumper->argv = argv;
 	display(dumper);
 
@@ -0,0 +1,30 @@
+/* vi: set sw=4 ts=4: */
+/*
+ * Utility routines.
+ *
+ * Licensed under GPLv2, see file LICENSE in this source tree.
+ */
+//kbuild:lib-$(CONFIG_FEATURE_PS_FORMAT) += print_json_string.o
+//kbuild:lib-$(CONFIG_FEATURE_TOP_JSON) += print_json_string.o
+
+#include "libbb.h"
+
+/* Print "str" to stdout as a JSON string, with quotes.
+ * Bytes >= 0x80 are passed through: it's UTF-8 if the data is.
+ */
+void FAST_FUNC print_json_string(const char *str)
+{
+	unsigned char c;
+
+	putchar('"');
+	while ((c = *str++) != '\0') {
+		if (c == '"' || c == '\\') {
+			putchar('\\');
+		} else if (c < ' ') {
+			printf("\\u%04x", c);
+			continue;
+		}
+		putchar(c);
+	}
+	putchar('"');
+}
@@ -81,6 +81,145 @@ static int read_to_buf(const char *filename, void *buf)
 	return ret;
 }
 
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+/* top re-reads /proc/PID/stat of every process on every refresh.
+ * With PSSCAN_KEEP_FDS, these files stay open between scans and are
+ * re-read with pread(): this saves a path lookup, open() and close()
+ * per process per refresh. Fds are kept in a hash keyed by PID
+ * (linear probing, PIDs are mostly sequential - no need to mix bits).
+ * Fds of PIDs not seen during a complete scan are closed.
+ */
+struct pid_fd {
+	unsigned pid; /* 0: empty slot */
+	int fd;       /* -1: PID is known, but stat file is not open */
+	unsigned gen;
+};
+static struct pid_fd_cache {
+	struct pid_fd *tab;
+	unsigned size; /* power of 2, at least twice as big as "used" */
+	unsigned used;
+	unsigned max;  /* never keep more fds than this */
+	unsigned gen;
+	int flags;     /* PSSCAN_TASKS of the previous scan */
+} *pid_fds;
+
+static struct pid_fd *find_pid_fd(unsigned pid)
+{
+	struct pid_fd *tab = pid_fds->tab;
+	unsigned mask = pid_fds->size - 1;
+	unsigned i = pid & mask;
+
+	while (tab[i].pid != 0 && tab[i].pid != pid)
+		i = (i + 1) & mask;
+	return &tab[i];
+}
+
+/* Reallocate the table, dropping entries not seen in current scan
+ * if "purge" is set */
+static void rehash_pid_fds(int purge)
+{
+	struct pid_fd *old = pid_fds->tab;
+	unsigned old_size = pid_fds->size;
+	unsigned i, size;
+
+	if (purge) {
+		pid_fds->used = 0;
+		for (i = 0; i < old_size; i++) {
+			if (old[i].pid == 0)
+				continue;
+			if (old[i].gen != pid_fds->gen) {
+				if (old[i].fd >= 0)
+					close(old[i].fd);
+				old[i].pid = 0;
+				continue;
+			}
+			pid_fds->used++;
+		}
+	}
+	size = 256;
+	while (size < pid_fds->used * 2 + 2)
+		size <<= 1;
+	pid_fds->size = size;
+	pid_fds->tab = xzalloc(size * sizeof(old[0]));
+	for (i = 0; i < old_size; i++) {
+		if (old[i].pid != 0)
+			*find_pid_fd(old[i].pid) = old[i];
+	}
+	free(old);
+}
+
+static void init_pid_fds(int flags)
+{
+	struct rlimit rl;
+
+	if (pid_fds) {
+		/* /proc/PID/stat and /proc/PID/task/PID/stat differ:
+		 * if we switched between them, drop everything */
+		if ((pid_fds->flags ^ flags) & PSSCAN_TASKS) {
+			pid_fds->gen++;
+			rehash_pid_fds(1);
+		}
+		pid_fds->flags = flags;
+		return;
+	}
+	pid_fds = xzalloc(sizeof(*pid_fds));
+	pid_fds->flags = flags;
+	/* 20000 processes need 20000 fds. Leave some for other uses */
+	getrlimit(RLIMIT_NOFILE, &rl);
+	if (rl.rlim_cur < rl.rlim_max) {
+		rl.rlim_cur = rl.rlim_max;
+		if (rl.rlim_cur > 1024 * 1024)
+			rl.rlim_cur = 1024 * 1024;
+		setrlimit(RLIMIT_NOFILE, &rl);
+		getrlimit(RLIMIT_NOFILE, &rl);
+	}
+	if (rl.rlim_cur > 1024 * 1024)
+		rl.rlim_cur = 1024 * 1024;
+	if (rl.rlim_cur > 64)
+		pid_fds->max = rl.rlim_cur - 64;
+	rehash_pid_fds(0);
+}
+
+/* Returns fd of /proc/[PID/task/]PID/stat, or -1 */
+static int get_stat_fd(unsigned pid, char *filename, char *filename_tail)
+{
+	struct pid_fd *p;
+	int fd;
+
+	p = find_pid_fd(pid);
+	if (p->pid == 0 && pid_fds->used >= pid_fds->max)
+		return -1;
+	p->gen = pid_fds->gen;
+	if (p->pid != 0 && p->fd >= 0)
+		return p->fd;
+
+	strcpy(filename_tail, "stat");
+	fd = open(filename, O_RDONLY | O_CLOEXEC);
+	*filename_tail = '\0';
+	if (fd < 0)
+		return fd;
+	if (p->pid == 0) {
+		if (++pid_fds->used * 2 + 2 > pid_fds->size) {
+			rehash_pid_fds(0);
+			p = find_pid_fd(pid);
+		}
+		p->pid = pid;
+		p->gen = pid_fds->gen;
+	}
+	p->fd = fd;
+	return fd;
+}
+
+/* pread() of a cached fd failed: the process is gone,
+ * the PID may be reused by now */
+static void drop_stat_fd(unsigned pid)
+{
+	struct pid_fd *p = find_pid_fd(pid);
+	close(p->fd);
+	p->fd = -1;
+}
+#endif
+
 static procps_status_t* FAST_FUNC alloc_procps_scan(void)
 {
 	procps_status_t* sp = xzalloc(sizeof(procps_status_t));
@@ -281,8 +420,13 @@ int FAST_FUNC procps_read_smaps(pid_t pid, struct smaprec *total,
 
 procps_status_t* FAST_FUNC procps_scan(procps_status_t* sp, int flags)
 {
-	if (!sp)
+	if (!sp) {
 		sp = alloc_procps_scan();
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+		if (flags & PSSCAN_KEEP_FDS)
+			init_pid_fds(flags);
+#endif
+	}
 
 	for (;;) {
 		struct dirent *entry;
@@ -292,6 +436,9 @@ procps_status_t* FAST_FUNC procps_scan(procps_status_t* sp, int flags)
 		int n;
 		char filename[sizeof("/proc/%u/task/%u/cmdline") + sizeof(int)*3 * 2];
 		char *filename_tail;
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+		int stat_fd;
+#endif
 
 #if ENABLE_FEATURE_SHOW_THREADS
 		if (sp->task_dir) {
@@ -304,6 +451,13 @@ procps_status_t* FAST_FUNC procps_scan(procps_status_t* sp, int flags)
 #endif
 		entry = readdir(sp->dir);
 		if (entry == NULL) {
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+			if (flags & PSSCAN_KEEP_FDS) {
+				/* Close fds of processes which are gone */
+				rehash_pid_fds(1);
+				pid_fds->gen++;
+			}
+#endif
 			free_procps_scan(sp);
 			return NULL;
 		}
@@ -349,9 +503,19 @@ procps_status_t* FAST_FUNC procps_scan(procps_status_t* sp, int flags)
 #endif
 			filename_tail = filename + sprintf(filename, "/proc/%u/", pid);
 
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+		stat_fd = -1;
+		if (flags & PSSCAN_KEEP_FDS)
+			stat_fd = get_stat_fd(pid, filename, filename_tail);
+#endif
 		if (flags & PSSCAN_UIDGID) {
 			struct stat sb;
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+			/* /proc/PID/stat has the same owner as /proc/PID */
+			if (stat_fd >= 0 ? fstat(stat_fd, &sb) : stat(filename, &sb))
+#else
 			if (stat(filename, &sb))
+#endif
 				continue; /* process probably exited */
 			/* Effective UID/GID, not real */
 			sp->uid = sb.st_uid;
@@ -374,6 +538,17 @@ procps_status_t* FAST_FUNC procps_scan(procps_status_t* sp, int flags)
 #endif
 			/* see proc(5) for some details on this */
 			strcpy(filename_tail, "stat");
+#if ENABLE_FEATURE_PROCPS_KEEP_FDS
+			if (stat_fd >= 0) {
+				n = pread(stat_fd, buf, PROCPS_BUFSIZE-1, 0);
+				if (n > 0) {
+					buf[n] = '\0';
+				} else {
+					drop_stat_fd(pid);
+					n = read_to_buf(filename, buf);
+				}
+			} else
+#endif
 			n = read_to_buf(filename, buf);
 			if (n < 0)
 				continue; /* process probably exited */
@@ -0,0 +1,57 @@
+/* vi: set sw=4 ts=4: */
+/*
+ * Utility routines.
+ *
+ * Sequential reading of big files in large blocks.
+ *
+ * Licensed under GPLv2, see file LICENSE in this source tree.
+ */
+//kbuild:lib-$(CONFIG_CMP)       += read_bulk.o
+//kbuild:lib-$(CONFIG_MD5SUM)    += read_bulk.o
+//kbuild:lib-$(CONFIG_SHA1SUM)   += read_bulk.o
+//kbuild:lib-$(CONFIG_SHA256SUM) += read_bulk.o
+//kbuild:lib-$(CONFIG_SHA512SUM) += read_bulk.o
+//kbuild:lib-$(CONFIG_SHA3SUM)   += read_bulk.o
+
+#include "libbb.h"
+
+/* Files and block devices are read with readahead hints:
+ * the kernel is told that we read sequentially (bigger readahead window),
+ * and after every read, to start reading the block we will want next.
+ * Then the disk stays busy while the caller works on the previous block.
+ */
+void FAST_FUNC bulk_reader_init(bulk_reader_t *br, int fd)
+{
+	struct stat st;
+
+	br->fd = fd;
+	br->hint = 0;
+#ifdef POSIX_FADV_SEQUENTIAL
+	if (fstat(fd, &st) == 0 && (S_ISREG(st.st_mode) || S_ISBLK(st.st_mode))) {
+		br->offset = lseek(fd, 0, SEEK_CUR);
+		if (br->offset >= 0) {
+			br->hint = 1;
+			posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+		}
+	}
+#endif
+}
+
+/* Like full_read(): short count only on EOF. len is at most BULK_READ_SIZE */
+ssize_t FAST_FUNC bulk_read(bulk_reader_t *br, void *buf, size_t len)
+{
+	ssize_t n = full_read(br->fd, buf, len);
+#ifdef POSIX_FADV_WILLNEED
+	if (br->hint && n > 0) {
+		br->offset += n;
+		posix_fadvise(br->fd, br->offset, BULK_READ_SIZE, POSIX_FADV_WILLNEED);
+	}
+#endif
+	return n;
+}
+
+/* Page aligned, so that the kernel can copy into it fast */
+void* FAST_FUNC xmalloc_bulk_buf(void)
+{
+	return xmmap_anon(BULK_READ_SIZE);
+}
@@ -0,0 +1 @@
+cmd_libpwdgrp/built-in.o :=  rm -f libpwdgrp/built-in.o; ar rcs libpwdgrp/built-in.o
@@ -0,0 +1 @@
+cmd_libpwdgrp/lib.a := rm -f libpwdgrp/lib.a; ar  rcs libpwdgrp/lib.a libpwdgrp/pwd_grp.o libpwdgrp/uidgid_get.o
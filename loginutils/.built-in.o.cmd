@@ -0,0 +1 @@
+cmd_loginutils/built-in.o :=  rm -f loginutils/built-in.o; ar rcs loginutils/built-in.o
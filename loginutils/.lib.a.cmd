@@ -0,0 +1 @@
+cmd_loginutils/lib.a := rm -f loginutils/lib.a; ar  rcs loginutils/lib.a loginutils/add-remove-shell.o loginutils/addgroup.o loginutils/adduser.o loginutils/chpasswd.o loginutils/cryptpw.o loginutils/deluser.o loginutils/getty.o loginutils/login.o loginutils/passwd.o loginutils/su.o loginutils/sulogin.o loginutils/vlock.o
@@ -0,0 +1 @@
+cmd_mailutils/built-in.o :=  rm -f mailutils/built-in.o; ar rcs mailutils/built-in.o
@@ -0,0 +1 @@
+cmd_mailutils/lib.a := rm -f mailutils/lib.a; ar  rcs mailutils/lib.a mailutils/mail.o mailutils/makemime.o mailutils/popmaildir.o mailutils/reformime.o mailutils/sendmail.o
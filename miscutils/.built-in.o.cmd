@@ -0,0 +1 @@
+cmd_miscutils/built-in.o :=  rm -f miscutils/built-in.o; ar rcs miscutils/built-in.o
@@ -0,0 +1 @@
+cmd_miscutils/lib.a := rm -f miscutils/lib.a; ar  rcs miscutils/lib.a miscutils/adjtimex.o miscutils/ascii.o miscutils/bc.o miscutils/beep.o miscutils/chat.o miscutils/conspy.o miscutils/crond.o miscutils/crontab.o miscutils/devmem.o miscutils/fbsplash.o miscutils/getfattr.o miscutils/hdparm.o miscutils/hexedit.o miscutils/i2c_tools.o miscutils/less.o miscutils/lsscsi.o miscutils/makedevs.o miscutils/man.o miscutils/microcom.o miscutils/mt.o miscutils/nandwrite.o miscutils/partprobe.o miscutils/raidautorun.o miscutils/readahead.o miscutils/runlevel.o miscutils/rx.o miscutils/seedrng.o miscutils/setfattr.o miscutils/setserial.o miscutils/strings.o miscutils/time.o miscutils/tree.o miscutils/ts.o miscutils/ttysize.o miscutils/ubi_tools.o miscutils/ubirename.o miscutils/volname.o miscutils/watchdog.o
@@ -276,7 +276,7 @@ typedef struct BcNum {
 #define BC_NUM_DEF_SIZE         16
 #define BC_NUM_PRINT_WIDTH      70
 
-#define BC_NUM_KARATSUBA_LEN    32
+#define BC_NUM_KARATSUBA_LEN    2048
 
 typedef enum BcInst {
 #if ENABLE_BC
@@ -1480,6 +1480,133 @@ static ssize_t bc_num_compare(BcDig *restrict a, BcDig *restrict b, size_t len)
 	}
 }
 
+// Multiplication and division work on base 10^9 limbs: BcDig arrays are
+// packed nine digits per limb on entry and unpacked on exit. This cuts
+// the inner loop iteration count by ~81 compared to digit-by-digit code,
+// and division no longer needs up to nine trial subtractions per digit.
+typedef uint32_t BcLimb;
+#define BC_LIMB_DIGS    9
+#define BC_LIMB_BASE    1000000000
+#define BC_NUM_LIMBS(n) (((n) + BC_LIMB_DIGS - 1) / BC_LIMB_DIGS)
+
+static void bc_digs_to_limbs(BcLimb *l, const BcDig *d, size_t n)
+{
+	while (n != 0) {
+		unsigned k = n < BC_LIMB_DIGS ? n : BC_LIMB_DIGS;
+		const BcDig *p = d + k;
+		BcLimb v = 0;
+		while (p != d)
+			v = v * 10 + *--p;
+		*l++ = v;
+		d += k;
+		n -= k;
+	}
+}
+
+// Writes exactly n digits
+static void bc_limbs_to_digs(BcDig *d, const BcLimb *l, size_t n)
+{
+	while (n != 0) {
+		unsigned k = n < BC_LIMB_DIGS ? n : BC_LIMB_DIGS;
+		BcLimb v = *l++;
+		n -= k;
+		do {
+			*d++ = v % 10;
+			v /= 10;
+		} while (--k);
+	}
+}
+
+// Knuth's algorithm D (TAOCP 4.3.1). u has m+1 limbs with u[m] == 0,
+// v has n limbs with v[n-1] != 0, m >= n. q receives m-n+1 limbs.
+// u and v are clobbered. Returns nonzero if interrupted.
+static int bc_limbs_div(BcLimb *q, BcLimb *u, size_t m, BcLimb *v, size_t n)
+{
+	BcLimb d, vtop, vnext;
+	size_t i, j;
+
+	if (n == 1) {
+		uint64_t rem = 0;
+		d = v[0];
+		for (i = m; i-- != 0;) {
+			rem = rem * BC_LIMB_BASE + u[i];
+			q[i] = rem / d;
+			rem %= d;
+		}
+		return 0;
+	}
+
+	// Normalize so that v[n-1] >= BASE/2, then qhat is off by at most 2
+	d = BC_LIMB_BASE / (v[n-1] + 1);
+	if (d != 1) {
+		BcLimb *p = u;
+		size_t len = m + 1;
+		for (;;) {
+			uint64_t carry = 0;
+			for (i = 0; i < len; i++) {
+				uint64_t t = (uint64_t)p[i] * d + carry;
+				p[i] = t % BC_LIMB_BASE;
+				carry = t / BC_LIMB_BASE;
+			}
+			if (p == v)
+				break;
+			p = v;
+			len = n;
+		}
+	}
+	vtop = v[n-1];
+	vnext = v[n-2];
+
+	for (j = m - n + 1; j-- != 0;) {
+		BcLimb *uj = u + j;
+		uint64_t num, qhat, rhat, carry;
+		int64_t t;
+		int borrow;
+
+		num = (uint64_t)uj[n] * BC_LIMB_BASE + uj[n-1];
+		qhat = num / vtop;
+		rhat = num % vtop;
+		while (qhat >= BC_LIMB_BASE
+		 || qhat * vnext > rhat * BC_LIMB_BASE + uj[n-2]
+		) {
+			qhat--;
+			rhat += vtop;
+			if (rhat >= BC_LIMB_BASE)
+				break;
+		}
+
+		carry = borrow = 0;
+		for (i = 0; i < n; i++) {
+			uint64_t p = qhat * v[i] + carry;
+			carry = p / BC_LIMB_BASE;
+			t = (int64_t)uj[i] - (int64_t)(p % BC_LIMB_BASE) - borrow;
+			borrow = (t < 0);
+			uj[i] = t + (borrow ? BC_LIMB_BASE : 0);
+		}
+		t = (int64_t)uj[n] - (int64_t)carry - borrow;
+		if (t < 0) {
+			// qhat was one too large: add v back
+			qhat--;
+			carry = 0;
+			for (i = 0; i < n; i++) {
+				BcLimb s = uj[i] + v[i] + (BcLimb)carry;
+				carry = (s >= BC_LIMB_BASE);
+				uj[i] = s - (carry ? BC_LIMB_BASE : 0);
+			}
+			t += carry;
+		}
+		uj[n] = t;
+		q[j] = qhat;
+#if ENABLE_FEATURE_BC_INTERACTIVE
+		// a=2^100000
+		// scale=40000
+		// 1/a <- without check below, this will not be interruptible
+		if (G_interrupt)
+			return 1;
+#endif
+	}
+	return 0;
+}
 #define BC_NUM_NEG(n, neg)      ((((ssize_t)(n)) ^ -((ssize_t)(neg))) + (neg))
 #define BC_NUM_ONE(n)           ((n)->len == 1 && (n)->rdx == 0 && (n)->num[0] == 1)
 #define BC_NUM_INT(n)           ((n)->len - (n)->rdx)
@@ -1894,33 +2021,46 @@ static FAST_FUNC BC_STATUS zbc_num_k(BcNum *restrict a, BcNum *restrict b,
 	 || b->len < BC_NUM_KARATSUBA_LEN
 	/* || a->len + b->len < BC_NUM_KARATSUBA_LEN - redundant check */
 	) {
-		size_t i, j, len;
-
-		bc_num_expand(c, a->len + b->len + 1);
-
-		memset(c->num, 0, sizeof(BcDig) * c->cap);
-		c->len = len = 0;
-
-		for (i = 0; i < b->len; ++i) {
-			unsigned carry = 0;
-			for (j = 0; j < a->len; ++j) {
-				unsigned in = c->num[i + j];
-				in += (unsigned)a->num[j] * (unsigned)b->num[i] + carry;
-				// note: compilers prefer _unsigned_ div/const
-				carry = in / 10;
-				c->num[i + j] = (BcDig)(in % 10);
+		BcLimb *la, *lb, *lc;
+		size_t i, j, na, nb, len;
+
+		na = BC_NUM_LIMBS(a->len);
+		nb = BC_NUM_LIMBS(b->len);
+		la = xzalloc((na + nb) * 2 * sizeof(BcLimb));
+		lb = la + na;
+		lc = lb + nb;
+		bc_digs_to_limbs(la, a->num, a->len);
+		bc_digs_to_limbs(lb, b->num, b->len);
+
+		for (i = 0; i < nb; ++i) {
+			uint64_t carry = 0;
+			BcLimb bi = lb[i];
+			if (bi == 0)
+				continue;
+			for (j = 0; j < na; ++j) {
+				uint64_t in = (uint64_t)la[j] * bi + lc[i + j] + carry;
+				carry = in / BC_LIMB_BASE;
+				lc[i + j] = in % BC_LIMB_BASE;
 			}
-
-			c->num[i + j] += (BcDig) carry;
-			len = BC_MAX(len, i + j + !!carry);
+			lc[i + j] = carry;
 
 #if ENABLE_FEATURE_BC_INTERACTIVE
 			// a=2^1000000
 			// a*a <- without check below, this will not be interruptible
-			if (G_interrupt) return BC_STATUS_FAILURE;
+			if (G_interrupt) {
+				free(la);
+				return BC_STATUS_FAILURE;
+			}
 #endif
 		}
 
+		len = a->len + b->len;
+		bc_num_expand(c, len + 1);
+		memset(c->num, 0, sizeof(BcDig) * c->cap);
+		bc_limbs_to_digs(c->num, lc, len);
+		free(la);
+		while (len != 0 && c->num[len - 1] == 0)
+			len--;
 		c->len = len;
 
 		RETURN_STATUS(BC_STATUS_SUCCESS);
@@ -2022,7 +2162,8 @@ static FAST_FUNC BC_STATUS zbc_num_m(BcNum *a, BcNum *b, BcNum *restrict c, size
 static FAST_FUNC BC_STATUS zbc_num_d(BcNum *a, BcNum *b, BcNum *restrict c, size_t scale)
 {
 	BcStatus s;
-	size_t len, end, i;
+	size_t len, end, nu, nv;
+	BcLimb *u, *v, *q;
 	BcNum cp;
 
 	if (b->len == 0)
@@ -2073,23 +2214,21 @@ static FAST_FUNC BC_STATUS zbc_num_d(BcNum *a, BcNum *b, BcNum *restrict c, size
 	c->rdx = cp.rdx;
 	c->len = cp.len;
 
+	// c = cp / b as integers: Q has at most "end" digits
+	// since the top digit of cp is zero.
 	s = BC_STATUS_SUCCESS;
-	for (i = end - 1; i < end; --i) {
-		BcDig *n, q;
-		n = cp.num + i;
-		for (q = 0; n[len] != 0 || bc_num_compare(n, b->num, len) >= 0; ++q)
-			bc_num_subArrays(n, b->num, len);
-		c->num[i] = q;
-#if ENABLE_FEATURE_BC_INTERACTIVE
-		// a=2^100000
-		// scale=40000
-		// 1/a <- without check below, this will not be interruptible
-		if (G_interrupt) {
-			s = BC_STATUS_FAILURE;
-			break;
-		}
-#endif
-	}
+	nu = BC_NUM_LIMBS(cp.len);
+	nv = BC_NUM_LIMBS(len);
+	u = xzalloc((nu + 1 + nv + nu) * sizeof(BcLimb));
+	v = u + nu + 1;
+	q = v + nv;
+	bc_digs_to_limbs(u, cp.num, cp.len);
+	bc_digs_to_limbs(v, b->num, len);
+	if (bc_limbs_div(q, u, nu, v, nv))
+		s = BC_STATUS_FAILURE;
+	else
+		bc_limbs_to_digs(c->num, q, end);
+	free(u);
 
 	bc_num_retireMul(c, scale, a->neg, b->neg);
 	bc_num_free(&cp);
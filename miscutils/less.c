@@ -31,6 +31,16 @@
 //config:	default 9999999
 //config:	depends on LESS
 //config:
+//config:config FEATURE_LESS_MMAP
+//config:	bool "Do not keep regular files in memory"
+//config:	default y
+//config:	depends on LESS
+//config:	help
+//config:	Regular files are mmapped and only the offsets of lines
+//config:	are stored, lines are rebuilt from the file when needed.
+//config:	Without this option, less keeps a copy of every line it has
+//config:	read, which for large files uses more memory than the file size.
+//config:
 //config:config FEATURE_LESS_BRACKETS
 //config:	bool "Enable bracket searching"
 //config:	default y
@@ -206,6 +216,17 @@ struct globals {
 	ssize_t readeof; /* must be signed */
 	const char **buffer;
 	const char **flines;
+#if ENABLE_FEATURE_LESS_MMAP
+	const char *map; /* if not NULL, stdin is a regular file mapped here */
+	size_t map_size;
+	size_t map_len; /* length of the mapping, map_size can shrink below it */
+	size_t *map_ofs; /* where flines[i] would start in map[] */
+	uint32_t *map_lineno; /* and its LINENO */
+	uint8_t *map_cooked; /* and whether add_chars() changed it */
+	char *map_lines; /* room to rebuild lines, see map_fline() */
+	size_t map_cut_ofs; /* if map_cut, map[] is zeroes from here on */
+	smallint map_cut; /* set by map_sigbus() */
+#endif
 	const char *empty_line_marker;
 	unsigned num_files;
 	unsigned current_file;
@@ -293,6 +314,21 @@ struct globals {
 #define MEMPTR(p) ((char*)(p) - 4)
 #define LINENO(p) (*(uint32_t*)((p) - 4))
 
+/* With a mapped file, flines[] is not used: lines are rebuilt
+ * from map[] on access. These return flines[i] and its LINENO.
+ * The string is valid until next FLINE(). */
+#if ENABLE_FEATURE_LESS_MMAP
+static const char *map_fline(unsigned i, unsigned slot);
+# define FLINE(i)   (G.map ? map_fline((i), max_displayed_line + 1) : flines[i])
+# define FLINENO(i) (G.map ? G.map_lineno[i] : LINENO(flines[i]))
+/* For buffer[row], valid until the screen is redrawn */
+# define SCREEN_FLINE(i, row) (G.map ? map_fline((i), (row)) : flines[i])
+#else
+# define FLINE(i)   (flines[i])
+# define FLINENO(i) LINENO(flines[i])
+# define SCREEN_FLINE(i, row) (flines[i])
+#endif
+
 
 /* Reset terminal input to normal */
 static void set_tty_cooked(void)
@@ -341,6 +377,10 @@ static NOINLINE void less_exit(void)
 
 #if (ENABLE_FEATURE_LESS_DASHCMD && ENABLE_FEATURE_LESS_LINENUMS) \
  || ENABLE_FEATURE_LESS_WINCH
+# if ENABLE_FEATURE_LESS_MMAP
+static void read_lines(void);
+static void goto_lineno(int target);
+# endif
 static void re_wrap(void)
 {
 	int w = width;
@@ -355,6 +395,33 @@ static void re_wrap(void)
 	char **new_flines = NULL;
 	char *d;
 
+#if ENABLE_FEATURE_LESS_MMAP
+	if (G.map) {
+		/* Index the file again, and find the top line we had */
+		size_t ofs = 0;
+
+		lineno = 0;
+		if (max_fline + 1 != 0) {
+			ofs = G.map_ofs[cur_fline];
+			lineno = FLINENO(cur_fline);
+		}
+		max_fline = -1;
+		cur_fline = 0;
+		max_lineno = 0;
+		readpos = 0;
+		terminated = 1;
+		eof_error = 1;
+# if ENABLE_FEATURE_LESS_REGEXP
+		pattern_valid = 0;
+# endif
+		read_lines();
+		goto_lineno(lineno);
+		while (cur_fline < max_fline && G.map_ofs[cur_fline + 1] <= ofs)
+			cur_fline++;
+		read_lines();
+		return;
+	}
+#endif
 	if (option_mask32 & FLAG_N)
 		w -= 8;
 
@@ -437,10 +504,233 @@ static int at_end(void)
 {
 	return (option_mask32 & FLAG_S)
 		? !(cur_fline <= max_fline &&
-			max_lineno > LINENO(flines[cur_fline]) + max_displayed_line)
+			max_lineno > FLINENO(cur_fline) + max_displayed_line)
 		: !(max_fline > cur_fline + max_displayed_line);
 }
 
+/* Add chars s[0..e) to the line at *pp, which is *posp screen positions
+ * wide already (takes into account tabs and backspaces).
+ * Stops after '\n' (returns 1), before a char which would make
+ * the line wider than w (returns 2), or at e (returns 0).
+ * *sp is advanced past the eaten chars.
+ */
+static int add_chars(char **pp, size_t *posp, int w,
+		const char **sp, const char *e, smallint *in_escape)
+{
+	char *p = *pp;
+	const char *s = *sp;
+	size_t pos = *posp;
+	int r = 0;
+
+	while (s < e) {
+		char c = *s;
+		/* Most chars are not special, make them fast */
+		if ((unsigned char)c >= ' ' && (int)pos < w
+		 && !(ENABLE_FEATURE_LESS_RAW && *in_escape)
+		) {
+			*p++ = c;
+			s++;
+			pos++;
+			continue;
+		}
+		/* backspace? [needed for manpages] */
+		/* <tab><bs> is (a) insane and */
+		/* (b) harder to do correctly, so we refuse to do it */
+		if (c == '\x8' && pos && p[-1] != '\t') {
+			s++; /* eat it */
+			pos--;
+		/* was buggy (p could end up <= current_line)... */
+			--p;
+			continue;
+		}
+#if ENABLE_FEATURE_LESS_RAW
+		if (option_mask32 & FLAG_R) {
+			if (c == '\033')
+				goto discard;
+			if (*in_escape) {
+				if (isdigit(c)
+				 || c == '['
+				 || c == ';'
+				 || c == 'm'
+				) {
+ discard:
+					*in_escape = (c != 'm');
+					s++;
+					continue;
+				}
+				/* Hmm, unexpected end of "ESC [ N ; N m" sequence */
+				*in_escape = 0;
+			}
+		}
+#endif
+		{
+			size_t new_pos = pos + 1;
+			if (c == '\t') {
+				new_pos += 7;
+				new_pos &= (~7);
+			}
+			if ((int)new_pos > w) {
+				r = 2;
+				break;
+			}
+			pos = new_pos;
+		}
+		/* ok, we will eat this char */
+		s++;
+		if (c == '\n') {
+			r = 1;
+			break;
+		}
+		/* NUL is substituted by '\n'! */
+		if (c == '\0') c = '\n';
+		*p++ = c;
+	}
+	*p = '\0';
+	*pp = p;
+	*posp = pos;
+	*sp = s;
+	return r;
+}
+
+#if ENABLE_FEATURE_LESS_MMAP
+static int line_width(void)
+{
+	return (option_mask32 & FLAG_N) ? width - 8 : width;
+}
+
+/* Regular files are not copied to flines[], they are mmapped
+ * and we only remember where the lines start */
+static void map_input(void)
+{
+	struct stat st;
+	void *m;
+
+	G.map = NULL;
+	if (fstat(STDIN_FILENO, &st) != 0
+	 || !S_ISREG(st.st_mode)
+	 || st.st_size <= 0
+	 || st.st_size != (off_t)(size_t)st.st_size
+	 /* "less <FILE" after someone read part of it */
+	 || lseek(STDIN_FILENO, 0, SEEK_CUR) != 0
+	) {
+		return;
+	}
+	m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+	if (m != MAP_FAILED) {
+		G.map = m;
+		G.map_size = G.map_len = st.st_size;
+	}
+}
+
+/* The file may be growing: map it again if it did */
+static void map_grow(void)
+{
+	struct stat st;
+	void *m;
+
+	if (fstat(STDIN_FILENO, &st) != 0
+	 || st.st_size <= (off_t)G.map_size
+	 || st.st_size != (off_t)(size_t)st.st_size
+	) {
+		return;
+	}
+	m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+	if (m != MAP_FAILED) {
+		munmap((void*)G.map, G.map_len);
+		G.map = m;
+		G.map_size = G.map_len = st.st_size;
+	}
+}
+
+/* The file may have been truncated under us (logrotate's copytruncate),
+ * and touching the map past its new end gets SIGBUS. Forget the lines
+ * which are gone, the one which was cut becomes the incomplete last line.
+ * Must be called before anything looks into the map, map_sigbus()
+ * covers truncations between the calls */
+static void map_shrink(void)
+{
+	struct stat st;
+	size_t size;
+
+	if (!G.map
+	 || fstat(STDIN_FILENO, &st) != 0
+	) {
+		return;
+	}
+	size = G.map_size;
+	if (st.st_size < (off_t)size)
+		size = st.st_size;
+	if (G.map_cut) {
+		/* Zeroes from map_cut_ofs on are not the file's, map it again */
+		void *m = MAP_FAILED;
+
+		if (st.st_size > 0 && st.st_size == (off_t)(size_t)st.st_size)
+			m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+		if (m != MAP_FAILED) {
+			munmap((void*)G.map, G.map_len);
+			G.map = m;
+			G.map_len = st.st_size;
+		}
+		if (size > G.map_cut_ofs)
+			size = G.map_cut_ofs;
+		G.map_cut = 0;
+	}
+	if (size == G.map_size)
+		return;
+	G.map_size = size;
+	readeof = G.map_size;
+	if (max_fline + 1 == 0)
+		return;
+	while (max_fline != 0 && G.map_ofs[max_fline] >= G.map_size)
+		max_fline--;
+	max_lineno = G.map_lineno[max_fline];
+	terminated = 0;
+	if (cur_fline > (int)max_fline)
+		cur_fline = max_fline;
+# if ENABLE_FEATURE_LESS_FLAGS
+	if (num_lines >= 0)
+		num_lines = REOPEN_STDIN; /* count again */
+# endif
+# if ENABLE_FEATURE_LESS_REGEXP
+	/* read_lines() matches the last line again */
+	while (num_matches && match_lines[num_matches - 1] >= max_fline)
+		num_matches--;
+# endif
+}
+
+static void map_free(void)
+{
+	munmap((void*)G.map, G.map_len);
+	G.map = NULL;
+	free(G.map_ofs);
+	G.map_ofs = NULL;
+	free(G.map_lineno);
+	G.map_lineno = NULL;
+	free(G.map_cooked);
+	G.map_cooked = NULL;
+	G.map_cut = 0;
+}
+
+/* Rebuild flines[i] in the given slot of map_lines[]:
+ * slots 0..max_displayed_line hold the screen, the last one
+ * is for FLINE() */
+static const char *map_fline(unsigned i, unsigned slot)
+{
+	char *line = G.map_lines + slot * (width + 5) + 4;
+	char *p = line;
+	const char *s = G.map + G.map_ofs[i];
+	size_t pos = 0;
+	smallint in_escape = 0;
+
+	LINENO(line) = G.map_lineno[i];
+	add_chars(&p, &pos, line_width(), &s,
+		G.map + (i < max_fline ? G.map_ofs[i + 1] : G.map_size),
+		&in_escape
+	);
+	return line;
+}
+#endif
+
 /* Devilishly complex routine.
  *
  * Has to deal with EOF and EPIPE on input,
@@ -464,22 +754,38 @@ static int at_end(void)
  *      (takes into account tabs and backspaces)
  * eof_error - < 0 error, == 0 EOF, > 0 not EOF/error
  *
+ * If the file is mapped, readbuf[] is the whole map[], and instead
+ * of storing lines in flines[] we store their offsets in map_ofs[].
+ * Incomplete last line is read again from its start next time.
+ *
  * "git log -p | less -m" on the kernel git tree is a good test for EAGAINs,
  * "/search on very long input" and "reaching max line count" corner cases.
  */
 static void read_lines(void)
 {
 	char *current_line, *p;
+	const char *readbuf;
 	int w = width;
-	char last_terminated = terminated;
+	char last_terminated;
 	time_t last_time = 0;
 	int retry_EAGAIN = 2;
+#if ENABLE_FEATURE_LESS_MMAP
+	size_t line_ofs;
+#endif
 #if ENABLE_FEATURE_LESS_REGEXP
-	unsigned old_max_fline = max_fline;
+	unsigned old_max_fline;
+#endif
+
+#if ENABLE_FEATURE_LESS_MMAP
+	map_shrink();
+#endif
+	last_terminated = terminated;
+#if ENABLE_FEATURE_LESS_REGEXP
+	old_max_fline = max_fline;
 #endif
 
-#define readbuf bb_common_bufsiz1
 	setup_common_bufsiz();
+	readbuf = bb_common_bufsiz1;
 
 	/* (careful: max_fline can be -1) */
 	if (max_fline + 1 > MAXLINES)
@@ -489,6 +795,18 @@ static void read_lines(void)
 		w -= 8;
 
 	p = current_line = ((char*)xmalloc(w + 5)) + 4;
+#if ENABLE_FEATURE_LESS_MMAP
+	if (G.map) {
+		readbuf = G.map;
+		if (!last_terminated) {
+			/* Read incomplete last line again */
+			readpos = G.map_ofs[max_fline];
+			last_terminated = 1;
+			max_fline--;
+		}
+		IF_FEATURE_LESS_RAW(G.in_escape = 0;)
+	}
+#endif
 	if (!last_terminated) {
 		const char *cp = flines[max_fline];
 		p = stpcpy(p, cp);
@@ -502,17 +820,34 @@ static void read_lines(void)
 	while (1) { /* read lines until we reach cur_fline or wanted_match */
 		*p = '\0';
 		terminated = 0;
+#if ENABLE_FEATURE_LESS_MMAP
+		line_ofs = readpos;
+#endif
 		while (1) { /* read chars until we have a line */
-			char c;
+			const char *s;
+			int r;
+
 			/* if no unprocessed chars left, eat more */
 			if (readpos >= readeof) {
-				int flags = ndelay_on(0);
-
+				int flags;
+#if ENABLE_FEATURE_LESS_MMAP
+				if (G.map) {
+					if ((size_t)readeof == G.map_size)
+						map_grow();
+					readbuf = G.map;
+					readeof = G.map_size;
+					eof_error = (readpos < readeof);
+					if (!eof_error)
+						goto reached_eof;
+					goto eat;
+				}
+#endif
+				flags = ndelay_on(0);
 				while (1) {
 					time_t t;
 
 					errno = 0;
-					eof_error = safe_read(STDIN_FILENO, readbuf, COMMON_BUFSIZE);
+					eof_error = safe_read(STDIN_FILENO, bb_common_bufsiz1, COMMON_BUFSIZE);
 					if (errno != EAGAIN)
 						break;
 					t = time(NULL);
@@ -530,58 +865,18 @@ static void read_lines(void)
 					goto reached_eof;
 				retry_EAGAIN = 1;
 			}
-			c = readbuf[readpos];
-			/* backspace? [needed for manpages] */
-			/* <tab><bs> is (a) insane and */
-			/* (b) harder to do correctly, so we refuse to do it */
-			if (c == '\x8' && last_line_pos && p[-1] != '\t') {
-				readpos++; /* eat it */
-				last_line_pos--;
-			/* was buggy (p could end up <= current_line)... */
-				*--p = '\0';
-				continue;
-			}
-#if ENABLE_FEATURE_LESS_RAW
-			if (option_mask32 & FLAG_R) {
-				if (c == '\033')
-					goto discard;
-				if (G.in_escape) {
-					if (isdigit(c)
-					 || c == '['
-					 || c == ';'
-					 || c == 'm'
-					) {
- discard:
-						G.in_escape = (c != 'm');
-						readpos++;
-						continue;
-					}
-					/* Hmm, unexpected end of "ESC [ N ; N m" sequence */
-					G.in_escape = 0;
-				}
-			}
-#endif
-			{
-				size_t new_last_line_pos = last_line_pos + 1;
-				if (c == '\t') {
-					new_last_line_pos += 7;
-					new_last_line_pos &= (~7);
-				}
-				if ((int)new_last_line_pos > w)
-					break;
-				last_line_pos = new_last_line_pos;
-			}
-			/* ok, we will eat this char */
-			readpos++;
-			if (c == '\n') {
+ IF_FEATURE_LESS_MMAP(eat:)
+			s = readbuf + readpos;
+			r = add_chars(&p, &last_line_pos, w,
+					&s, readbuf + readeof,
+					IF_FEATURE_LESS_RAW(&G.in_escape) IF_NOT_FEATURE_LESS_RAW(NULL));
+			readpos = s - readbuf;
+			if (r == 1) {
 				terminated = 1;
 				last_line_pos = 0;
-				break;
 			}
-			/* NUL is substituted by '\n'! */
-			if (c == '\0') c = '\n';
-			*p++ = c;
-			*p = '\0';
+			if (r)
+				break;
 		} /* end of "read chars until we have a line" loop */
 #if 0
 //BUG: also triggers on this:
@@ -598,10 +893,25 @@ static void read_lines(void)
 #endif
  reached_eof:
 		last_terminated = terminated;
-		flines = xrealloc_vector(flines, 8, max_fline);
+#if ENABLE_FEATURE_LESS_MMAP
+		if (G.map) {
+			/* Backspaces and ESCs shorten the line, NULs become '\n's */
+			size_t len = readpos - line_ofs - terminated;
+			G.map_ofs = xrealloc_vector(G.map_ofs, 8, max_fline);
+			G.map_lineno = xrealloc_vector(G.map_lineno, 8, max_fline);
+			G.map_cooked = xrealloc_vector(G.map_cooked, 8, max_fline);
+			G.map_ofs[max_fline] = line_ofs;
+			G.map_lineno[max_fline] = max_lineno;
+			G.map_cooked[max_fline] = (p - current_line != len
+					|| memchr(current_line, '\n', len));
+		} else
+#endif
+		{
+			flines = xrealloc_vector(flines, 8, max_fline);
 
-		flines[max_fline] = (char*)xrealloc(MEMPTR(current_line), strlen(current_line) + 1 + 4) + 4;
-		LINENO(flines[max_fline]) = max_lineno;
+			flines[max_fline] = (char*)xrealloc(MEMPTR(current_line), strlen(current_line) + 1 + 4) + 4;
+			LINENO(flines[max_fline]) = max_lineno;
+		}
 		if (terminated)
 			max_lineno++;
 
@@ -624,11 +934,31 @@ static void read_lines(void)
 		if (eof_error <= 0) {
 			break;
 		}
+#if ENABLE_FEATURE_LESS_MMAP
+		/* Truncated, don't go on reading map_sigbus()'s zeroes */
+		if (G.map_cut)
+			break;
+#endif
 		max_fline++;
+#if ENABLE_FEATURE_LESS_MMAP
+		if (G.map) {
+			/* current_line was not stored, reuse it */
+			p = current_line;
+			last_line_pos = 0;
+			continue;
+		}
+#endif
 		current_line = ((char*)xmalloc(w + 5)) + 4;
 		p = current_line;
 		last_line_pos = 0;
 	} /* end of "read lines until we reach cur_fline" loop */
+#if ENABLE_FEATURE_LESS_MMAP
+	if (G.map) {
+		free(MEMPTR(current_line));
+		if (G.map_cut)
+			map_shrink();
+	}
+#endif
 
 	if (eof_error < 0) {
 		if (errno == EAGAIN) {
@@ -647,7 +977,6 @@ static void read_lines(void)
 	/* prevent us from being stuck in search for a match */
 	wanted_match = -1;
 #endif
-#undef readbuf
 }
 
 #if ENABLE_FEATURE_LESS_FLAGS
@@ -660,7 +989,7 @@ static int safe_lineno(int fline)
 	if (fline < 0)
 		return 0;
 
-	return LINENO(flines[fline]) + 1;
+	return FLINENO(fline) + 1;
 }
 
 /* count number of lines in file */
@@ -674,6 +1003,19 @@ static void update_num_lines(void)
 	/* only do this for regular files */
 	if (num_lines == REOPEN_AND_COUNT || num_lines == REOPEN_STDIN) {
 		count = 0;
+#if ENABLE_FEATURE_LESS_MMAP
+		if (G.map) {
+			const char *s = G.map;
+			const char *e = s + G.map_size;
+			while ((s = memchr(s, '\n', e - s)) != NULL) {
+				s++;
+				if (++count == MAXLINES)
+					break;
+			}
+			num_lines = count;
+			return;
+		}
+#endif
 		fd = open("/proc/self/fd/0", O_RDONLY);
 		if (fd < 0 && num_lines == REOPEN_AND_COUNT) {
 			/* "filename" is valid only if REOPEN_AND_COUNT */
@@ -929,25 +1271,25 @@ static void buffer_fill_and_print(void)
 
 	if (option_mask32 & FLAG_S) {
 		/* Go back to the beginning of this line */
-		while (fpos && LINENO(flines[fpos]) == LINENO(flines[fpos-1]))
+		while (fpos && FLINENO(fpos) == FLINENO(fpos-1))
 			fpos--;
 	}
 
 	i = 0;
 	while (i <= max_displayed_line && fpos <= max_fline) {
-		int lineno = LINENO(flines[fpos]);
-		buffer[i] = flines[fpos];
+		int lineno = FLINENO(fpos);
+		buffer[i] = SCREEN_FLINE(fpos, i);
 		i++;
 		do {
 			fpos++;
 		} while ((fpos <= max_fline)
 		      && (option_mask32 & FLAG_S)
-		      && lineno == LINENO(flines[fpos])
+		      && lineno == FLINENO(fpos)
 		);
 	}
 #else
 	for (i = 0; i <= max_displayed_line && cur_fline + i <= max_fline; i++) {
-		buffer[i] = flines[cur_fline + i];
+		buffer[i] = SCREEN_FLINE(cur_fline + i, i);
 	}
 #endif
 	for (; i <= max_displayed_line; i++) {
@@ -962,19 +1304,19 @@ static void goto_lineno(int target)
 	if (target <= 0 ) {
 		cur_fline = 0;
 	}
-	else if (target > LINENO(flines[cur_fline])) {
+	else if (target > FLINENO(cur_fline)) {
  retry:
-		while (LINENO(flines[cur_fline]) != target && cur_fline < max_fline)
+		while (FLINENO(cur_fline) != target && cur_fline < max_fline)
 			++cur_fline;
 		/* target not reached but more input is available */
-		if (LINENO(flines[cur_fline]) != target && eof_error > 0) {
+		if (FLINENO(cur_fline) != target && eof_error > 0) {
 			read_lines();
 			goto retry;
 		}
 	}
 	else {
 		/* search backwards through already-read lines */
-		while (LINENO(flines[cur_fline]) != target && cur_fline > 0)
+		while (FLINENO(cur_fline) != target && cur_fline > 0)
 			--cur_fline;
 	}
 }
@@ -984,7 +1326,7 @@ static void cap_cur_fline(void)
 	if ((option_mask32 & FLAG_S)) {
 		if (cur_fline > max_fline)
 			cur_fline = max_fline;
-		if (LINENO(flines[cur_fline]) + max_displayed_line > max_lineno + TILDES) {
+		if (FLINENO(cur_fline) + max_displayed_line > max_lineno + TILDES) {
 			goto_lineno(max_lineno - max_displayed_line + TILDES);
 			read_lines();
 		}
@@ -1001,7 +1343,7 @@ static void cap_cur_fline(void)
 static void buffer_down(int nlines)
 {
 	if ((option_mask32 & FLAG_S))
-		goto_lineno(LINENO(flines[cur_fline]) + nlines);
+		goto_lineno(FLINENO(cur_fline) + nlines);
 	else
 		cur_fline += nlines;
 	read_lines();
@@ -1012,7 +1354,7 @@ static void buffer_down(int nlines)
 static void buffer_up(int nlines)
 {
 	if ((option_mask32 & FLAG_S)) {
-		goto_lineno(LINENO(flines[cur_fline]) - nlines);
+		goto_lineno(FLINENO(cur_fline) - nlines);
 	}
 	else {
 		cur_fline -= nlines;
@@ -1063,6 +1405,9 @@ static void open_file_and_read_lines(void)
 		num_lines = REOPEN_STDIN;
 #endif
 	}
+#if ENABLE_FEATURE_LESS_MMAP
+	map_input();
+#endif
 	readpos = 0;
 	readeof = 0;
 	last_line_pos = 0;
@@ -1070,6 +1415,17 @@ static void open_file_and_read_lines(void)
 	read_lines();
 }
 
+static void alloc_buffer(void)
+{
+	free(buffer);
+	buffer = xmalloc((max_displayed_line+1) * sizeof(char *));
+#if ENABLE_FEATURE_LESS_MMAP
+	/* Lines of a mapped file for each screen line, plus one for FLINE() */
+	free(G.map_lines);
+	G.map_lines = xmalloc((max_displayed_line + 2) * (width + 5));
+#endif
+}
+
 /* Reinitialize everything for a new file - free the memory and start over */
 static void reinitialize(void)
 {
@@ -1081,6 +1437,10 @@ static void reinitialize(void)
 		free(flines);
 		flines = NULL;
 	}
+#if ENABLE_FEATURE_LESS_MMAP
+	if (G.map)
+		map_free();
+#endif
 
 	max_fline = -1;
 	cur_fline = 0;
@@ -1337,6 +1697,29 @@ static void goto_match(int match)
 	}
 }
 
+#if ENABLE_FEATURE_LESS_MMAP && defined(REG_STARTEND)
+/* Match flines[i] of a mapped file right in the map, unless add_chars()
+ * changed it. The last line may not end where the map does, rebuild it too */
+static int map_regexec(unsigned i)
+{
+	regmatch_t m;
+	const char *s, *e;
+
+	if (i >= max_fline || G.map_cooked[i])
+		return regexec(&pattern, map_fline(i, max_displayed_line + 1), 0, NULL, 0);
+	s = G.map + G.map_ofs[i];
+	e = G.map + G.map_ofs[i + 1];
+	if (e != s && e[-1] == '\n')
+		e--;
+	m.rm_so = 0;
+	m.rm_eo = e - s;
+	return regexec(&pattern, s, 1, &m, REG_STARTEND);
+}
+# define fline_regexec(i) (G.map ? map_regexec(i) : regexec(&pattern, flines[i], 0, NULL, 0))
+#else
+# define fline_regexec(i) regexec(&pattern, FLINE(i), 0, NULL, 0)
+#endif
+
 static void fill_match_lines(unsigned pos)
 {
 	if (!pattern_valid)
@@ -1344,7 +1727,7 @@ static void fill_match_lines(unsigned pos)
 	/* Run the regex on each line of the current file */
 	while (pos <= max_fline) {
 		/* If this line matches */
-		if (regexec(&pattern, flines[pos], 0, NULL, 0) == 0
+		if (fline_regexec(pos) == 0
 		/* and we didn't match it last time */
 		 && !(num_matches && match_lines[num_matches-1] == pos)
 		) {
@@ -1567,7 +1950,7 @@ static void save_input_to_file(void)
 			goto ret;
 		}
 		for (i = 0; i <= max_fline; i++)
-			fprintf(fp, "%s\n", flines[i]);
+			fprintf(fp, "%s\n", FLINE(i));
 		fclose(fp);
 		msg = "Done";
 	}
@@ -1642,7 +2025,7 @@ static void match_right_bracket(char bracket)
 	unsigned i = cur_fline;
 
 	if (i >= max_fline
-	 || strchr(flines[i], bracket) == NULL
+	 || strchr(FLINE(i), bracket) == NULL
 	) {
 		print_statusline("No bracket in top line");
 		return;
@@ -1650,7 +2033,7 @@ static void match_right_bracket(char bracket)
 
 	bracket = opp_bracket(bracket);
 	for (; i < max_fline; i++) {
-		if (strchr(flines[i], bracket) != NULL) {
+		if (strchr(FLINE(i), bracket) != NULL) {
 			/*
 			 * Line with matched right bracket becomes
 			 * last visible line
@@ -1667,7 +2050,7 @@ static void match_left_bracket(char bracket)
 	int i = cur_fline + max_displayed_line;
 
 	if (i >= max_fline
-	 || strchr(flines[i], bracket) == NULL
+	 || strchr(FLINE(i), bracket) == NULL
 	) {
 		print_statusline("No bracket in bottom line");
 		return;
@@ -1675,7 +2058,7 @@ static void match_left_bracket(char bracket)
 
 	bracket = opp_bracket(bracket);
 	for (; i >= 0; i--) {
-		if (strchr(flines[i], bracket) != NULL) {
+		if (strchr(FLINE(i), bracket) != NULL) {
 			/*
 			 * Line with matched left bracket becomes
 			 * first visible line
@@ -1690,6 +2073,9 @@ static void match_left_bracket(char bracket)
 
 static void keypress_process(int keypress)
 {
+#if ENABLE_FEATURE_LESS_MMAP
+	map_shrink();
+#endif
 	switch (keypress) {
 	case KEYCODE_DOWN: case 'e': case 'j': case 0x0d:
 		buffer_down(1);
@@ -1800,6 +2186,28 @@ static void sig_catcher(int sig)
 	kill_myself_with_sig(sig); /* does not return */
 }
 
+#if ENABLE_FEATURE_LESS_MMAP
+/* The file was truncated after map_shrink() looked at it, and the map
+ * has nothing behind it from the faulting page on. Put zeroed pages
+ * there, so that the access can go on, and have map_shrink() drop
+ * the lines read from them */
+static void map_sigbus(int sig, siginfo_t *si, void *ucontext UNUSED_PARAM)
+{
+	uintptr_t page = (uintptr_t)si->si_addr & -(uintptr_t)getpagesize();
+	uintptr_t end = (uintptr_t)G.map + G.map_len;
+
+	if (!G.map
+	 || page < (uintptr_t)G.map || page >= end
+	 || mmap((void*)page, end - page, PROT_READ,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED
+	) {
+		sig_catcher(sig);
+	}
+	G.map_cut_ofs = page - (uintptr_t)G.map;
+	G.map_cut = 1;
+}
+#endif
+
 #if ENABLE_FEATURE_LESS_WINCH
 static void sigwinch_handler(int sig UNUSED_PARAM)
 {
@@ -1908,8 +2316,18 @@ int less_main(int argc, char **argv)
 #if ENABLE_FEATURE_LESS_WINCH
 	signal(SIGWINCH, sigwinch_handler);
 #endif
+#if ENABLE_FEATURE_LESS_MMAP
+	{
+		struct sigaction sa;
+
+		memset(&sa, 0, sizeof(sa));
+		sa.sa_sigaction = map_sigbus;
+		sa.sa_flags = SA_SIGINFO;
+		sigaction_set(SIGBUS, &sa);
+	}
+#endif
 
-	buffer = xmalloc((max_displayed_line+1) * sizeof(char *));
+	alloc_buffer();
 	reinitialize();
 	while (1) {
 		int64_t keypress;
@@ -1926,8 +2344,7 @@ int less_main(int argc, char **argv)
 			if (max_displayed_line < 3)
 				max_displayed_line = 3;
 			max_displayed_line -= 2;
-			free(buffer);
-			buffer = xmalloc((max_displayed_line+1) * sizeof(char *));
+			alloc_buffer();
 			/* Avoid re-wrap and/or redraw if we already know
 			 * we need to do it again. These ops are expensive */
 			if (WINCH_COUNTER)
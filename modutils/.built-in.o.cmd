@@ -0,0 +1 @@
+cmd_modutils/built-in.o :=  rm -f modutils/built-in.o; ar rcs modutils/built-in.o
@@ -0,0 +1 @@
+cmd_modutils/lib.a := rm -f modutils/lib.a; ar  rcs modutils/lib.a modutils/modinfo.o modutils/modprobe-small.o modutils/modutils.o
@@ -0,0 +1 @@
+cmd_networking/built-in.o :=  rm -f networking/built-in.o; ar rcs networking/built-in.o
@@ -0,0 +1 @@
+cmd_networking/lib.a := rm -f networking/lib.a; ar  rcs networking/lib.a networking/arp.o networking/arping.o networking/brctl.o networking/dnsd.o networking/ether-wake.o networking/ftpd.o networking/ftpgetput.o networking/hostname.o networking/httpd.o networking/ifconfig.o networking/ifenslave.o networking/ifplugd.o networking/ifupdown.o networking/inetd.o networking/interface.o networking/ip.o networking/ipcalc.o networking/isrv.o networking/isrv_identd.o networking/nameif.o networking/nbd-client.o networking/nc.o networking/netstat.o networking/nslookup.o networking/ntpd.o networking/parse_pasv_epsv.o networking/ping.o networking/pscan.o networking/route.o networking/slattach.o networking/ssl_client.o networking/tc.o networking/tcpudp.o networking/tcpudp_perhost.o networking/telnet.o networking/telnetd.o networking/tftp.o networking/tls.o networking/tls_aes.o networking/tls_aesgcm.o networking/tls_fe.o networking/tls_pstm.o networking/tls_pstm_montgomery_reduce.o networking/tls_pstm_mul_comba.o networking/tls_pstm_sqr_comba.o networking/tls_rsa.o networking/tls_sp_c32.o networking/traceroute.o networking/tunctl.o networking/vconfig.o networking/wget.o networking/whois.o networking/zcip.o
@@ -0,0 +1 @@
+cmd_networking/libiproute/built-in.o :=  rm -f networking/libiproute/built-in.o; ar rcs networking/libiproute/built-in.o
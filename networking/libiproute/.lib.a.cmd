@@ -0,0 +1 @@
+cmd_networking/libiproute/lib.a := rm -f networking/libiproute/lib.a; ar  rcs networking/libiproute/lib.a networking/libiproute/ip_parse_common_args.o networking/libiproute/ipaddress.o networking/libiproute/iplink.o networking/libiproute/ipneigh.o networking/libiproute/iproute.o networking/libiproute/iprule.o networking/libiproute/iptunnel.o networking/libiproute/libnetlink.o networking/libiproute/ll_addr.o networking/libiproute/ll_map.o networking/libiproute/ll_proto.o networking/libiproute/ll_types.o networking/libiproute/rt_names.o networking/libiproute/rtm_map.o networking/libiproute/utils.o
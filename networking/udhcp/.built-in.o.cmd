@@ -0,0 +1 @@
+cmd_networking/udhcp/built-in.o :=  rm -f networking/udhcp/built-in.o; ar rcs networking/udhcp/built-in.o
@@ -0,0 +1 @@
+cmd_networking/udhcp/lib.a := rm -f networking/udhcp/lib.a; ar  rcs networking/udhcp/lib.a networking/udhcp/arpping.o networking/udhcp/common.o networking/udhcp/d6_dhcpc.o networking/udhcp/d6_packet.o networking/udhcp/d6_socket.o networking/udhcp/dhcpc.o networking/udhcp/dhcpd.o networking/udhcp/dhcprelay.o networking/udhcp/domain_codec.o networking/udhcp/dumpleases.o networking/udhcp/packet.o networking/udhcp/signalpipe.o networking/udhcp/socket.o
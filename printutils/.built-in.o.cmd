@@ -0,0 +1 @@
+cmd_printutils/built-in.o :=  rm -f printutils/built-in.o; ar rcs printutils/built-in.o
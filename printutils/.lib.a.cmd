@@ -0,0 +1 @@
+cmd_printutils/lib.a := rm -f printutils/lib.a; ar  rcs printutils/lib.a printutils/lpd.o printutils/lpr.o
@@ -0,0 +1 @@
+cmd_procps/built-in.o :=  rm -f procps/built-in.o; ar rcs procps/built-in.o
@@ -0,0 +1 @@
+cmd_procps/lib.a := rm -f procps/lib.a; ar  rcs procps/lib.a procps/free.o procps/fuser.o procps/iostat.o procps/kill.o procps/lsof.o procps/mpstat.o procps/nmeter.o procps/pgrep.o procps/pidof.o procps/pmap.o procps/powertop.o procps/ps.o procps/pstree.o procps/pwdx.o procps/smemcap.o procps/sysctl.o procps/top.o procps/uptime.o procps/watch.o
@@ -44,6 +44,14 @@
 //config:	Include support for measuring HZ on old kernels and non-ELF systems
 //config:	(if you are on Linux 2.4.0+ and use ELF, you don't need this)
 //config:
+//config:config FEATURE_PS_FORMAT
+//config:	bool "Enable --format=json|csv"
+//config:	default y
+//config:	depends on (PS || MINIPS) && DESKTOP && LONG_OPTS
+//config:	help
+//config:	Machine-readable output of -o columns: one JSON object
+//config:	per line, or CSV. Numbers are not scaled or padded.
+//config:
 //config:config FEATURE_PS_ADDITIONAL_COLUMNS
 //config:	bool "Enable -o rgroup, -o ruser, -o nice specifiers"
 //config:	default y
@@ -63,6 +71,9 @@
 //usage:#define ps_full_usage "\n\n"
 //usage:       "Show list of processes\n"
 //usage:     "\n	-o COL1,COL2=HEADER	Select columns for display"
+//usage:	IF_FEATURE_PS_FORMAT(
+//usage:     "\n	--format=json|csv	JSON lines or CSV output"
+//usage:	)
 //usage:	IF_FEATURE_SHOW_THREADS(
 //usage:     "\n	-T			Show threads"
 //usage:	)
@@ -172,8 +183,15 @@ typedef struct {
 	const char *header;
 	void (*f)(char *buf, int size, const procps_status_t *ps);
 	int ps_flags;
+	IF_FEATURE_PS_FORMAT(smallint numeric;) /* --format: print unquoted */
 } ps_out_t;
 
+#if ENABLE_FEATURE_PS_FORMAT
+# define NUM , 1
+#else
+# define NUM
+#endif
+
 struct globals {
 	ps_out_t* out;
 	int out_cnt;
@@ -181,6 +199,9 @@ struct globals {
 	int need_flags;
 	char *buffer;
 	unsigned terminal_width;
+#if ENABLE_FEATURE_PS_FORMAT
+	smallint format; /* FORMAT_TEXT/JSON/CSV */
+#endif
 #if ENABLE_FEATURE_PS_TIME
 # if ENABLE_FEATURE_PS_UNUSUAL_SYSTEMS || !defined(__linux__)
 	unsigned kernel_HZ;
@@ -197,6 +218,13 @@ struct globals {
 #define terminal_width     (G.terminal_width    )
 #define INIT_G() do { setup_common_bufsiz(); } while (0)
 
+#if ENABLE_FEATURE_PS_FORMAT
+enum { FORMAT_TEXT, FORMAT_JSON, FORMAT_CSV };
+# define raw_numbers (G.format != FORMAT_TEXT)
+#else
+# define raw_numbers 0
+#endif
+
 #if ENABLE_FEATURE_PS_TIME
 # if ENABLE_FEATURE_PS_UNUSUAL_SYSTEMS || !defined(__linux__)
 #  define get_kernel_HZ() (G.kernel_HZ)
@@ -271,6 +299,10 @@ static void put_lu(char *buf, int size, unsigned long u)
 {
 	char buf4[5];
 
+	if (raw_numbers) {
+		sprintf(buf, "%lu", u);
+		return;
+	}
 	/* see http://en.wikipedia.org/wiki/Tera */
 	smart_ulltoa4(u, buf4, " mgtpezy")[0] = '\0';
 	sprintf(buf, "%.*s", size, buf4);
@@ -314,6 +346,10 @@ static void format_time(char *buf, int size, unsigned long tt)
 {
 	unsigned ff;
 
+	if (raw_numbers) {
+		sprintf(buf, "%lu", tt);
+		return;
+	}
 	/* Used to show "14453:50" if tt is large. Ugly.
 	 * procps-ng 3.3.10 uses "[[dd-]hh:]mm:ss" format.
 	 * TODO: switch to that?
@@ -381,27 +417,27 @@ static const ps_out_t out_spec[] ALIGN_PTR = {
 	{ 8                  , "group" ,"GROUP"  ,func_group ,PSSCAN_UIDGID  },
 	{ 16                 , "comm"  ,"COMMAND",func_comm  ,PSSCAN_COMM    },
 	{ MAX_WIDTH          , "args"  ,"COMMAND",func_args  ,PSSCAN_COMM    },
-	{ 5                  , "pid"   ,"PID"    ,func_pid   ,PSSCAN_PID     },
-	{ 5                  , "ppid"  ,"PPID"   ,func_ppid  ,PSSCAN_PPID    },
-	{ 5                  , "pgid"  ,"PGID"   ,func_pgid  ,PSSCAN_PGID    },
+	{ 5                  , "pid"   ,"PID"    ,func_pid   ,PSSCAN_PID      NUM },
+	{ 5                  , "ppid"  ,"PPID"   ,func_ppid  ,PSSCAN_PPID     NUM },
+	{ 5                  , "pgid"  ,"PGID"   ,func_pgid  ,PSSCAN_PGID     NUM },
 #if ENABLE_FEATURE_PS_TIME
-	{ sizeof("ELAPSED")-1, "etime" ,"ELAPSED",func_etime ,PSSCAN_START_TIME },
+	{ sizeof("ELAPSED")-1, "etime" ,"ELAPSED",func_etime ,PSSCAN_START_TIME NUM },
 #endif
 #if ENABLE_FEATURE_PS_ADDITIONAL_COLUMNS
-	{ 5                  , "nice"  ,"NI"     ,func_nice  ,PSSCAN_NICE    },
+	{ 5                  , "nice"  ,"NI"     ,func_nice  ,PSSCAN_NICE     NUM },
 	{ 8                  , "rgroup","RGROUP" ,func_rgroup,PSSCAN_RUIDGID },
 	{ 8                  , "ruser" ,"RUSER"  ,func_ruser ,PSSCAN_RUIDGID },
 //	{ 5                  , "pcpu"  ,"%CPU"   ,func_pcpu  ,PSSCAN_        },
 #endif
 #if ENABLE_FEATURE_PS_TIME
-	{ 5                  , "time"  ,"TIME"   ,func_time  ,PSSCAN_STIME | PSSCAN_UTIME },
+	{ 5                  , "time"  ,"TIME"   ,func_time  ,PSSCAN_STIME | PSSCAN_UTIME NUM },
 #endif
 	{ 6                  , "tty"   ,"TT"     ,func_tty   ,PSSCAN_TTY     },
-	{ 4                  , "vsz"   ,"VSZ"    ,func_vsz   ,PSSCAN_VSZ     },
+	{ 4                  , "vsz"   ,"VSZ"    ,func_vsz   ,PSSCAN_VSZ      NUM },
 /* Not mandated, but useful: */
-	{ 5                  , "sid"   ,"SID"    ,func_sid   ,PSSCAN_SID     },
+	{ 5                  , "sid"   ,"SID"    ,func_sid   ,PSSCAN_SID      NUM },
 	{ 4                  , "stat"  ,"STAT"   ,func_state ,PSSCAN_STATE   },
-	{ 4                  , "rss"   ,"RSS"    ,func_rss   ,PSSCAN_RSS     },
+	{ 4                  , "rss"   ,"RSS"    ,func_rss   ,PSSCAN_RSS      NUM },
 #if ENABLE_SELINUX
 	{ 35                 , "label" ,"LABEL"  ,func_label ,PSSCAN_CONTEXT },
 #endif
@@ -481,6 +517,11 @@ static void alloc_line_buffer(void)
 			print_header = 1;
 		}
 		width += out[i].width + 1; /* "FIELD " */
+		if (raw_numbers) {
+			/* Fields are formatted one by one, and not truncated */
+			width = MAX_WIDTH;
+			continue;
+		}
 		if ((int)(width - terminal_width) > 0) {
 			/* The rest does not fit on the screen */
 			//out[i].width -= (width - terminal_width - 1);
@@ -495,12 +536,61 @@ static void alloc_line_buffer(void)
 	buffer = xmalloc(width + 1); /* for trailing \0 */
 }
 
+#if ENABLE_FEATURE_PS_FORMAT
+static void print_csv_string(const char *str)
+{
+	if (!strpbrk(str, ",\"\r\n")) {
+		fputs_stdout(str);
+		return;
+	}
+	putchar('"');
+	while (*str) {
+		if (*str == '"')
+			putchar('"');
+		putchar(*str++);
+	}
+	putchar('"');
+}
+
+/* One JSON object per line, or CSV. Keys (CSV header) are -o names */
+static void format_process_machine(const procps_status_t *ps)
+{
+	int i;
+
+	if (G.format == FORMAT_JSON)
+		putchar('{');
+	for (i = 0; i < out_cnt; i++) {
+		if (i != 0)
+			putchar(',');
+		if (G.format == FORMAT_JSON)
+			printf("\"%.6s\":", out[i].name6);
+		out[i].f(buffer, out[i].numeric ? 0 : MAX_WIDTH, ps);
+		if (out[i].numeric)
+			fputs_stdout(buffer[0] ? buffer : (G.format == FORMAT_JSON ? "null" : ""));
+		else if (G.format == FORMAT_JSON)
+			print_json_string(buffer);
+		else
+			print_csv_string(buffer);
+	}
+	puts(G.format == FORMAT_JSON ? "}" : "");
+}
+#endif
+
 static void format_header(void)
 {
 	int i;
 	ps_out_t* op;
 	char *p;
 
+#if ENABLE_FEATURE_PS_FORMAT
+	if (G.format == FORMAT_CSV) {
+		for (i = 0; i < out_cnt; i++)
+			printf(&",%.6s"[i == 0], out[i].name6);
+		bb_putchar('\n');
+	}
+	if (raw_numbers)
+		return;
+#endif
 	if (!print_header)
 		return;
 	p = buffer;
@@ -554,8 +644,11 @@ int ps_main(int argc UNUSED_PARAM, char **argv)
 	procps_status_t *p;
 	llist_t* opt_o = NULL;
 	char default_o[sizeof(DEFAULT_O_STR)];
-#if ENABLE_SELINUX || ENABLE_FEATURE_SHOW_THREADS
+#if ENABLE_SELINUX || ENABLE_FEATURE_SHOW_THREADS || ENABLE_FEATURE_PS_FORMAT
 	int opt;
+#endif
+#if ENABLE_FEATURE_PS_FORMAT
+	const char *format;
 #endif
 	enum {
 		OPT_Z = (1 << 0),
@@ -567,6 +660,7 @@ int ps_main(int argc UNUSED_PARAM, char **argv)
 		OPT_f = (1 << 6),
 		OPT_l = (1 << 7),
 		OPT_T = (1 << 8) * ENABLE_FEATURE_SHOW_THREADS,
+		OPT_format = (1 << (8 + ENABLE_FEATURE_SHOW_THREADS)) * ENABLE_FEATURE_PS_FORMAT,
 	};
 
 	INIT_G();
@@ -592,10 +686,21 @@ int ps_main(int argc UNUSED_PARAM, char **argv)
 	 * procps v3.2.7 supports -T and shows tids as SPID column,
 	 * it also supports -L where it shows tids as LWP column.
 	 */
-#if ENABLE_SELINUX || ENABLE_FEATURE_SHOW_THREADS
+#if ENABLE_SELINUX || ENABLE_FEATURE_SHOW_THREADS || ENABLE_FEATURE_PS_FORMAT
 	opt =
 #endif
-		getopt32(argv, "Zo:*aAdefl"IF_FEATURE_SHOW_THREADS("T"), &opt_o);
+		getopt32long(argv, "Zo:*aAdefl"IF_FEATURE_SHOW_THREADS("T"),
+			IF_FEATURE_PS_FORMAT("format\0" Required_argument "\xff") "",
+			&opt_o IF_FEATURE_PS_FORMAT(, &format)
+		);
+#if ENABLE_FEATURE_PS_FORMAT
+	if (opt & OPT_format) {
+		static const char formats[] ALIGN1 = "text\0""json\0""csv\0";
+		G.format = index_in_strings(formats, format);
+		if (G.format < 0)
+			bb_error_msg_and_die("bad --format '%s'", format);
+	}
+#endif
 
 	if (opt_o) {
 		do {
@@ -634,6 +739,12 @@ int ps_main(int argc UNUSED_PARAM, char **argv)
 
 	p = NULL;
 	while ((p = procps_scan(p, need_flags)) != NULL) {
+#if ENABLE_FEATURE_PS_FORMAT
+		if (raw_numbers) {
+			format_process_machine(p);
+			continue;
+		}
+#endif
 		format_process(p);
 	}
 
@@ -110,6 +110,14 @@
 //config:	depends on TOP
 //config:	help
 //config:	Enable 's' in top (gives lots of memory info).
+//config:
+//config:config FEATURE_TOP_JSON
+//config:	bool "Support --json output"
+//config:	default y
+//config:	depends on TOP && LONG_OPTS
+//config:	help
+//config:	Add --json option which implies -b and prints one JSON object
+//config:	per process per iteration, for consumption by scripts.
 
 //applet:IF_TOP(APPLET(top, BB_DIR_USR_BIN, BB_SUID_DROP))
 
@@ -156,10 +164,13 @@ enum { SORT_DEPTH = 3 };
 
 /* Screens wider than this are unlikely */
 enum { LINE_BUF_SIZE = 512 - 64 };
+/* --json prints whole command lines: as long as ps shows them */
+enum { JSON_ARGS_SIZE = 2*1024 };
 
 struct globals {
 	top_status_t *top;
 	int ntop;
+	unsigned sorted_cnt; /* top[0..sorted_cnt-1] are in final order */
 	smallint inverted;
 #if ENABLE_FEATURE_TOPMEM
 	smallint sort_field;
@@ -181,6 +192,8 @@ struct globals {
 	cmp_funcp sort_function[SORT_DEPTH];
 	struct save_hist *prev_hist;
 	unsigned prev_hist_count;
+	unsigned *prev_hist_hash; /* by pid: index into prev_hist + 1, or 0 */
+	unsigned prev_hist_mask;
 	jiffy_counts_t cur_jif, prev_jif;
 	/* int hist_iterations; */
 	unsigned total_pcpu;
@@ -195,6 +208,9 @@ struct globals {
 	char kbd_input[KEYCODE_BUFFER_SIZE];
 #endif
 	char line_buf[LINE_BUF_SIZE];
+#if ENABLE_FEATURE_TOP_JSON
+	char json_args[JSON_ARGS_SIZE];
+#endif
 };
 #define G (*ptr_to_globals)
 #define top              (G.top               )
@@ -206,6 +222,8 @@ struct globals {
 #define sort_function    (G.sort_function     )
 #define prev_hist        (G.prev_hist         )
 #define prev_hist_count  (G.prev_hist_count   )
+#define prev_hist_hash   (G.prev_hist_hash    )
+#define prev_hist_mask   (G.prev_hist_mask    )
 #define cur_jif          (G.cur_jif           )
 #define prev_jif         (G.prev_jif          )
 #define cpu_jif          (G.cpu_jif           )
@@ -224,9 +242,11 @@ enum {
 	OPT_b = (1 << 2),
 	OPT_H = (1 << 3),
 	OPT_m = (1 << 4),
-	OPT_EOF = (1 << 5), /* pseudo: "we saw EOF in stdin" */
+	OPT_JSON = (1 << 5) * ENABLE_FEATURE_TOP_JSON,
+	OPT_EOF = (1 << (5 + ENABLE_FEATURE_TOP_JSON)), /* pseudo: "we saw EOF in stdin" */
 };
 #define OPT_BATCH_MODE (option_mask32 & OPT_b)
+#define OPT_JSON_MODE  (option_mask32 & OPT_JSON)
 
 
 #if ENABLE_FEATURE_TOP_INTERACTIVE
@@ -357,18 +377,23 @@ static void do_stats(void)
 	top_status_t *cur;
 	pid_t pid;
 	int n;
-	unsigned i, last_i;
+	unsigned i, j, mask;
 	struct save_hist *new_hist;
+	unsigned *new_hash;
 
 	get_jiffy_counts();
 	total_pcpu = 0;
 	/* total_vsz = 0; */
 	new_hist = xmalloc(sizeof(new_hist[0]) * ntop);
+	/* Open addressing hash of new_hist[] by pid, at most half full.
+	 * Pids are mostly sequential, no need to mix bits */
+	mask = 255;
+	while (mask < (unsigned)ntop * 2)
+		mask = mask * 2 + 1;
+	new_hash = xzalloc(sizeof(new_hash[0]) * (mask + 1));
 	/*
 	 * Make a pass through the data to get stats.
 	 */
-	/* hist_iterations = 0; */
-	i = 0;
 	for (n = 0; n < ntop; n++) {
 		cur = top + n;
 
@@ -379,21 +404,21 @@ static void do_stats(void)
 		pid = cur->pid;
 		new_hist[n].ticks = cur->ticks;
 		new_hist[n].pid = pid;
+		for (i = pid & mask; new_hash[i]; i = (i + 1) & mask)
+			continue;
+		new_hash[i] = n + 1;
 
 		/* find matching entry from previous pass */
 		cur->pcpu = 0;
-		/* do not start at index 0, continue at last used one
-		 * (brought hist_iterations from ~14000 down to 172) */
-		last_i = i;
-		if (prev_hist_count) do {
-			if (prev_hist[i].pid == pid) {
-				cur->pcpu = cur->ticks - prev_hist[i].ticks;
-				total_pcpu += cur->pcpu;
-				break;
+		if (prev_hist_count) {
+			for (i = pid & prev_hist_mask; (j = prev_hist_hash[i]) != 0; i = (i + 1) & prev_hist_mask) {
+				if (prev_hist[j - 1].pid == pid) {
+					cur->pcpu = cur->ticks - prev_hist[j - 1].ticks;
+					total_pcpu += cur->pcpu;
+					break;
+				}
 			}
-			i = (i+1) % prev_hist_count;
-			/* hist_iterations++; */
-		} while (i != last_i);
+		}
 		/* total_vsz += cur->vsz; */
 	}
 
@@ -401,7 +426,10 @@ static void do_stats(void)
 	 * Save cur frame's information.
 	 */
 	free(prev_hist);
+	free(prev_hist_hash);
 	prev_hist = new_hist;
+	prev_hist_hash = new_hash;
+	prev_hist_mask = mask;
 	prev_hist_count = ntop;
 }
 
@@ -609,7 +637,7 @@ static NOINLINE void display_process_list(int lines_rem, int scr_width)
 	};
 
 	top_status_t *s;
-	unsigned long total_memory = display_header(scr_width, &lines_rem); /* or use total_vsz? */
+	unsigned long total_memory;
 	/* xxx_shift and xxx_scale variables allow us to replace
 	 * expensive divides with multiply and shift */
 	unsigned pmem_shift, pmem_scale, pmem_half;
@@ -630,20 +658,33 @@ typedef struct { unsigned quot, rem; } bb_div_t;
 # define CALC_STAT(name, val) bb_div_t name = { (val) / 10, (val) % 10 }
 # define SHOW_STAT(name) name.quot, '0'+name.rem
 # define FMT "%3u.%c"
+# define JSON_FMT "%u.%c"
 #else
 # define UPSCALE 100
 # define CALC_STAT(name, val) unsigned name = (val)
 # define SHOW_STAT(name) name
 # define FMT "%4u%%"
+# define JSON_FMT "%u"
 #endif
 
-	/* what info of the processes is shown */
-	printf(OPT_BATCH_MODE ? "%.*s" : ESC"[7m" "%.*s" ESC"[m", scr_width,
-		"  PID  PPID USER     STAT   VSZ %VSZ"
-		IF_FEATURE_TOP_SMP_PROCESS(" CPU")
-		IF_FEATURE_TOP_CPU_USAGE_PERCENTAGE(" %CPU")
-		" COMMAND");
-	lines_rem--;
+#if ENABLE_FEATURE_TOP_JSON
+	if (OPT_JSON_MODE) {
+		/* No header lines: records only */
+		unsigned long meminfo[MI_MAX];
+		parse_meminfo(meminfo);
+		total_memory = meminfo[MI_MEMTOTAL];
+	} else
+#endif
+	{
+		total_memory = display_header(scr_width, &lines_rem); /* or use total_vsz? */
+		/* what info of the processes is shown */
+		printf(OPT_BATCH_MODE ? "%.*s" : ESC"[7m" "%.*s" ESC"[m", scr_width,
+			"  PID  PPID USER     STAT   VSZ %VSZ"
+			IF_FEATURE_TOP_SMP_PROCESS(" CPU")
+			IF_FEATURE_TOP_CPU_USAGE_PERCENTAGE(" %CPU")
+			" COMMAND");
+		lines_rem--;
+	}
 
 	/*
 	 * %VSZ = s->vsz/MemTotal
@@ -707,6 +748,28 @@ typedef struct { unsigned quot, rem; } bb_div_t;
 		CALC_STAT(pcpu, (s->pcpu*pcpu_scale + pcpu_half) >> pcpu_shift);
 #endif
 
+#if ENABLE_FEATURE_TOP_JSON
+		if (OPT_JSON_MODE) {
+			/* Raw values, no column truncation; stdout is fully buffered */
+			printf("{\"pid\":%u,\"ppid\":%u,\"user\":", s->pid, s->ppid);
+			print_json_string(get_cached_username(s->uid));
+			printf(",\"stat\":\"%.*s\",\"vsz\":%lu,\"pvsz\":" JSON_FMT
+				IF_FEATURE_TOP_SMP_PROCESS(",\"cpu\":%d")
+				IF_FEATURE_TOP_CPU_USAGE_PERCENTAGE(",\"pcpu\":" JSON_FMT)
+				",\"args\":",
+				/* state is blank-padded to 3 chars */
+				(int)(strchrnul(s->state, ' ') - s->state), s->state,
+				s->vsz, SHOW_STAT(pmem)
+				IF_FEATURE_TOP_SMP_PROCESS(, s->last_seen_on_cpu)
+				IF_FEATURE_TOP_CPU_USAGE_PERCENTAGE(, SHOW_STAT(pcpu))
+			);
+			read_cmdline(G.json_args, JSON_ARGS_SIZE, s->pid, s->comm);
+			print_json_string(G.json_args);
+			puts("}");
+			s++;
+			continue;
+		}
+#endif
 		smart_ulltoa5(s->vsz, vsz_str_buf, " mgtpezy");
 		/* PID PPID USER STAT VSZ %VSZ [%CPU] COMMAND */
 		n = sprintf(ppubuf, "%5u %5u %-8.8s", s->pid, s->ppid, get_cached_username(s->uid));
@@ -755,9 +818,11 @@ typedef struct { unsigned quot, rem; } bb_div_t;
 		s++;
 	}
 	/* printf(" %d", hist_iterations); */
-	bb_putchar(OPT_BATCH_MODE ? '\n' : '\r');
+	if (!OPT_JSON_MODE)
+		bb_putchar(OPT_BATCH_MODE ? '\n' : '\r');
 	fflush_all();
 }
+#undef JSON_FMT
 #undef UPSCALE
 #undef SHOW_STAT
 #undef CALC_STAT
@@ -944,7 +1009,8 @@ enum {
 		| PSSCAN_STATE
 		| PSSCAN_COMM
 		| PSSCAN_CPU
-		| PSSCAN_UIDGID,
+		| PSSCAN_UIDGID
+		| PSSCAN_KEEP_FDS,
 	TOPMEM_MASK = 0
 		| PSSCAN_PID
 		| PSSCAN_SMAPS
@@ -953,6 +1019,77 @@ enum {
 	NO_RESCAN_MASK = (unsigned)-1,
 };
 
+static void swap_elems(char *a, char *b, unsigned size)
+{
+	while (size--) {
+		char t = *a;
+		*a++ = *b;
+		*b++ = t;
+	}
+}
+
+/* Make base[0..k-1] the k smallest elements, in sorted order.
+ * Only a screenful of processes is shown: no need to sort all 10000,
+ * quickselect (three-way, since most processes compare equal:
+ * they use no CPU) the first k of them, then sort only these.
+ */
+static void sort_first_k(char *base, unsigned n, unsigned size, unsigned k,
+		int (*cmp)(const void *, const void *))
+{
+	if (k < n) {
+		char *pivot = xmalloc(size);
+		unsigned lo = 0, hi = n;
+
+		while (hi - lo > 1) {
+			/* [lo,lt) < pivot, [lt,i) == pivot, [gt,hi) > pivot */
+			unsigned lt = lo, i = lo, gt = hi;
+
+			memcpy(pivot, base + (lo + (hi - lo) / 2) * size, size);
+			while (i < gt) {
+				int c = cmp(base + i * size, pivot);
+				if (c < 0)
+					swap_elems(base + lt++ * size, base + i++ * size, size);
+				else if (c > 0)
+					swap_elems(base + i * size, base + --gt * size, size);
+				else
+					i++;
+			}
+			if (k < lt)
+				hi = lt;
+			else if (k >= gt)
+				lo = gt;
+			else
+				break;
+		}
+		free(pivot);
+	}
+	qsort(base, k, size, cmp);
+}
+
+/* Sort far enough to display G.lines entries starting at G_scroll_ofs */
+static void sort_process_list(unsigned scan_mask IF_NOT_FEATURE_TOPMEM(UNUSED_PARAM))
+{
+	unsigned k = G_scroll_ofs + G.lines;
+
+	if (k > (unsigned)ntop)
+		k = ntop;
+	if (k <= G.sorted_cnt)
+		return;
+	IF_FEATURE_TOPMEM(if (scan_mask != TOPMEM_MASK)) {
+#if ENABLE_FEATURE_TOP_CPU_USAGE_PERCENTAGE
+		sort_first_k((char*)top, ntop, sizeof(top_status_t), k, (void*)mult_lvl_cmp);
+#else
+		sort_first_k((char*)top, ntop, sizeof(top_status_t), k, (void*)(sort_function[0]));
+#endif
+	}
+#if ENABLE_FEATURE_TOPMEM
+	else { /* TOPMEM */
+		sort_first_k((char*)topmem, ntop, sizeof(topmem_status_t), k, (void*)topmem_sort);
+	}
+#endif
+	G.sorted_cnt = k;
+}
+
 #if ENABLE_FEATURE_TOP_INTERACTIVE
 static unsigned handle_input(unsigned scan_mask, duration_t interval)
 {
@@ -1102,7 +1239,7 @@ static unsigned handle_input(unsigned scan_mask, duration_t interval)
 //usage:#endif
 //usage:#define top_trivial_usage
 //usage:       "[-b"IF_FEATURE_TOPMEM("m")IF_FEATURE_SHOW_THREADS("H")"]"
-//usage:       " [-n COUNT] [-d SECONDS]"
+//usage:       " [-n COUNT] [-d SECONDS]"IF_FEATURE_TOP_JSON(" [--json]")
 //usage:#define top_full_usage "\n\n"
 //usage:       "Show a view of process activity in real time."
 //usage:   "\n""Read the status of all processes from /proc each SECONDS"
@@ -1132,6 +1269,9 @@ static unsigned handle_input(unsigned scan_mask, duration_t interval)
 //usage:   "\n""	-b	Batch mode"
 //usage:   "\n""	-n N	Exit after N iterations"
 //usage:   "\n""	-d SEC	Delay between updates"
+//usage:	IF_FEATURE_TOP_JSON(
+//usage:   "\n""	--json	Batch mode, one JSON object per process"
+//usage:	)
 //usage:	IF_FEATURE_TOPMEM(
 //usage:   "\n""	-m	Same as 's' key"
 //usage:	)
@@ -1172,7 +1312,18 @@ int top_main(int argc UNUSED_PARAM, char **argv)
 
 	/* all args are options; -n NUM */
 	make_all_argv_opts(argv); /* options can be specified w/o dash */
+#if ENABLE_FEATURE_TOP_JSON
+	col = getopt32long(argv, "d:n:bHm",
+		"json\0" No_argument "\xff",
+		&str_interval, &str_iterations);
+	if (col & OPT_JSON) {
+		if (col & OPT_m) /* only the process list has a JSON form */
+			bb_show_usage();
+		option_mask32 |= OPT_b;
+	}
+#else
 	col = getopt32(argv, "d:n:bHm", &str_interval, &str_iterations);
+#endif
 	/* NB: -m and -H are accepted even if not configured */
 #if ENABLE_FEATURE_TOPMEM
 	if (col & OPT_m) /* -m (busybox specific) */
@@ -1290,8 +1441,8 @@ int top_main(int argc UNUSED_PARAM, char **argv)
 			break;
 		}
 
-		IF_FEATURE_TOPMEM(if (scan_mask != TOPMEM_MASK)) {
 #if ENABLE_FEATURE_TOP_CPU_USAGE_PERCENTAGE
+		IF_FEATURE_TOPMEM(if (scan_mask != TOPMEM_MASK)) {
 			if (!prev_hist_count) {
 				do_stats();
 				usleep(100000);
@@ -1299,18 +1450,11 @@ int top_main(int argc UNUSED_PARAM, char **argv)
 				continue;
 			}
 			do_stats();
-			/* TODO: we don't need to sort all 10000 processes, we need to find top 24! */
-			qsort(top, ntop, sizeof(top_status_t), (void*)mult_lvl_cmp);
-#else
-			qsort(top, ntop, sizeof(top_status_t), (void*)(sort_function[0]));
-#endif
-		}
-#if ENABLE_FEATURE_TOPMEM
-		else { /* TOPMEM */
-			qsort(topmem, ntop, sizeof(topmem_status_t), (void*)topmem_sort);
 		}
 #endif
+		G.sorted_cnt = 0;
  IF_FEATURE_TOP_INTERACTIVE(display:)
+		sort_process_list(scan_mask);
 		IF_FEATURE_TOPMEM(if (scan_mask != TOPMEM_MASK)) {
 			display_process_list(G.lines, col);
 		}
@@ -1333,7 +1477,8 @@ int top_main(int argc UNUSED_PARAM, char **argv)
 #endif
 	} /* end of "while (not Q)" */
 
-	bb_putchar('\n');
+	if (!OPT_JSON_MODE)
+		bb_putchar('\n');
 #if ENABLE_FEATURE_TOP_INTERACTIVE
 	reset_term();
 #endif
@@ -1341,6 +1486,7 @@ int top_main(int argc UNUSED_PARAM, char **argv)
 		clearmems();
 #if ENABLE_FEATURE_TOP_CPU_USAGE_PERCENTAGE
 		free(prev_hist);
+		free(prev_hist_hash);
 #endif
 	}
 	return EXIT_SUCCESS;
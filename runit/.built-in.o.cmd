@@ -0,0 +1 @@
+cmd_runit/built-in.o :=  rm -f runit/built-in.o; ar rcs runit/built-in.o
@@ -0,0 +1 @@
+cmd_runit/lib.a := rm -f runit/lib.a; ar  rcs runit/lib.a runit/chpst.o runit/runsv.o runit/runsvdir.o runit/sv.o runit/svlogd.o
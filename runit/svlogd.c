@@ -60,6 +60,12 @@ ttimeout
 !processor
     tells svlogd to feed each recent log file through processor
     (see above) on log file rotation. By default log files are not processed.
+z
+    (busybox extension) tells svlogd to gzip each recent log file
+    on log file rotation, using the built-in gzip code in a background
+    process. Unlike !processor, rotation never waits for the previous
+    file to be compressed: rotated files are queued and compressed
+    oldest first. Ignored if !processor is also given.
 ua.b.c.d[:port]
     tells svlogd to transmit the first len characters of selected
     log messages to the IP address a.b.c.d, port number port.
@@ -130,6 +136,15 @@ log message, you can use a pattern like this instead
 //config:	svlogd continuously reads log data from its standard input, optionally
 //config:	filters log messages, and writes the data to one or more automatically
 //config:	rotated logs.
+//config:
+//config:config FEATURE_SVLOGD_COMPRESS
+//config:	bool "Support built-in compression of rotated logs"
+//config:	default y
+//config:	depends on SVLOGD && GZIP && !NOMMU
+//config:	help
+//config:	Enable "z" line in DIR/config: rotated log files are compressed
+//config:	by a background child running the gzip applet code, without
+//config:	spawning a shell. Rotation never waits for it to finish.
 
 //applet:IF_SVLOGD(APPLET(svlogd, BB_DIR_USR_SBIN, BB_SUID_DROP))
 
@@ -153,6 +168,9 @@ log message, you can use a pattern like this instead
 ///////:   "\n""NNUM - min number files to retain" - confusing
 ///////:   "\n""tSEC - rotate file if it get SEC seconds old" - confusing
 //usage:   "\n""!PROG - process rotated log with PROG"
+//usage:	IF_FEATURE_SVLOGD_COMPRESS(
+//usage:   "\n""z - gzip rotated logs in background"
+//usage:	)
 ///////:   "\n""uIPADDR - send log over UDP" - unsupported
 ///////:   "\n""UIPADDR - send log over UDP and DONT log" - unsupported
 ///////:   "\n""pPFX - prefix each line with PFX" - unsupported
@@ -188,6 +206,12 @@ struct logdir {
 	char fnsave[FMT_PTIME];
 	char match;
 	char matcherr;
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+	char compress;
+	int zpid;
+	/* file being compressed by zpid, @TAI64N.u */
+	char fnproc[FMT_PTIME];
+#endif
 };
 
 
@@ -214,6 +238,11 @@ struct globals {
 
 	char repl;
 	const char *replace;
+	/* stamp is refreshed once per read(), not once per line */
+	smallint stamp_stale;
+	char stamp[FMT_PTIME];
+	/* nonzero for chars to be replaced by repl */
+	char replmap[256];
 	int fl_flag_0;
 	unsigned dirn;
 
@@ -519,6 +548,11 @@ static void rmoldest(struct logdir *ld)
 	while ((f = readdir(d))) {
 		if ((f->d_name[0] == '@') && (strlen(f->d_name) == 27)) {
 			if (f->d_name[26] == 't') {
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+				/* compressor's output, still being written */
+				if (ld->zpid && memcmp(f->d_name, ld->fnproc, 26) == 0)
+					continue;
+#endif
 				if (unlink(f->d_name) == -1)
 					warn2("can't unlink processor leftover", f->d_name);
 			} else {
@@ -541,6 +575,115 @@ static void rmoldest(struct logdir *ld)
 	}
 }
 
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+/* Must be called with cwd = ld->fddir */
+static void compressorstart(struct logdir *ld)
+{
+	DIR *d;
+	struct dirent *f;
+	int pid;
+
+	if (!ld->compress || ld->processor || ld->zpid || exitasap)
+		return;
+
+	/* Pick the oldest not yet compressed file */
+	ld->fnproc[0] = '\0';
+	d = opendir(".");
+	if (!d) {
+		warn2("can't open directory, want compress", ld->name);
+		return;
+	}
+	while ((f = readdir(d)) != NULL) {
+		if (f->d_name[0] == '@' && strlen(f->d_name) == 27
+		 && f->d_name[26] == 'u'
+		 && (!ld->fnproc[0] || strcmp(f->d_name, ld->fnproc) < 0)
+		) {
+			memcpy(ld->fnproc, f->d_name, 28);
+		}
+	}
+	closedir(d);
+	if (!ld->fnproc[0])
+		return;
+
+	/* Child's exit() must not write out our stdio buffers again */
+	fflush_all();
+	while ((pid = fork()) == -1)
+		pause2cannot("fork for compressor", ld->name);
+	if (!pid) {
+		/* child */
+		char *argv[2];
+		int fd;
+
+		sigprocmask(SIG_UNBLOCK, &blocked_sigset, NULL);
+		if (verbose)
+			bb_error_msg(INFO"compressing: %s/%s", ld->name, ld->fnproc);
+		fd = open_or_warn(ld->fnproc, O_RDONLY|O_NDELAY);
+		if (fd < 0)
+			_exit(0); /* gone (rmoldest?), nothing to do */
+		xmove_fd(fd, 0);
+		ld->fnproc[26] = 't';
+		xmove_fd(xopen(ld->fnproc, O_WRONLY|O_NDELAY|O_TRUNC|O_CREAT), 1);
+
+		/* Run gzip applet code in this process, no exec */
+		argv[0] = (char*)"gzip";
+		argv[1] = NULL;
+		xfunc_error_retval = EXIT_FAILURE;
+		GETOPT_RESET();
+		set_task_comm(argv[0]);
+		run_applet_no_and_exit(find_applet_by_name(argv[0]), argv[0], argv);
+	}
+	ld->zpid = pid;
+}
+
+static void compressorstop(struct logdir *ld)
+{
+	char f[28];
+
+	if (ld->zpid) {
+		sig_unblock(SIGHUP);
+		while (safe_waitpid(ld->zpid, &wstat, 0) == -1)
+			pause2cannot("wait for compressor", ld->name);
+		sig_block(SIGHUP);
+		ld->zpid = 0;
+	}
+	if (ld->fddir == -1)
+		return;
+	while (fchdir(ld->fddir) == -1)
+		pause2cannot("change directory, want compressor", ld->name);
+	memcpy(f, ld->fnproc, 28);
+	f[26] = 't';
+	if (!WIFEXITED(wstat) || WEXITSTATUS(wstat) != 0) {
+		/* Leave .u file in place, next rotation retries it */
+		warnx("compressor failed", ld->name);
+		unlink(f);
+		goto ret;
+	}
+	if (access(ld->fnproc, F_OK) != 0) {
+		/* rmoldest() deleted it meanwhile, so drop the result too */
+		unlink(f);
+		goto next;
+	}
+	ld->fnproc[26] = 's';
+	while (rename(f, ld->fnproc) == -1)
+		pause2cannot("rename compressed", ld->name);
+	while (chmod(ld->fnproc, 0744) == -1)
+		pause2cannot("set mode of compressed", ld->name);
+	f[26] = 'u';
+	if (unlink(f) == -1)
+		bb_error_msg(WARNING"can't unlink: %s/%s", ld->name, f);
+	if (verbose)
+		bb_error_msg(INFO"compressed: %s/%s", ld->name, ld->fnproc);
+ next:
+	/* Next queued file, if any */
+	compressorstart(ld);
+ ret:
+	while (fchdir(fdwdir) == -1)
+		pause1cannot("change to initial working directory");
+}
+#else
+# define compressorstart(ld) ((void)0)
+#endif
+
 static unsigned rotate(struct logdir *ld)
 {
 	struct stat st;
@@ -560,7 +703,7 @@ static unsigned rotate(struct logdir *ld)
 	/* create new filename */
 	ld->fnsave[25] = '.';
 	ld->fnsave[26] = 's';
-	if (ld->processor)
+	if (ld->processor IF_FEATURE_SVLOGD_COMPRESS(|| ld->compress))
 		ld->fnsave[26] = 'u';
 	ld->fnsave[27] = '\0';
 	do {
@@ -602,6 +745,7 @@ static unsigned rotate(struct logdir *ld)
 
 		rmoldest(ld);
 		processorstart(ld);
+		compressorstart(ld);
 	}
 
 	while (fchdir(fdwdir) == -1)
@@ -742,6 +886,7 @@ static NOINLINE unsigned logdir_open(struct logdir *ld, const char *fn)
 	ld->name = (char*)fn;
 	ld->ppid = 0;
 	ld->match = '+';
+	IF_FEATURE_SVLOGD_COMPRESS(ld->compress = 0;)
 	free(ld->inst); ld->inst = NULL;
 	free(ld->processor); ld->processor = NULL;
 
@@ -809,6 +954,11 @@ static NOINLINE unsigned logdir_open(struct logdir *ld, const char *fn)
 					ld->processor = wstrdup(&s[1]);
 				}
 				break;
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+			case 'z':
+				ld->compress = 1;
+				break;
+#endif
 			}
 			s = np;
 		}
@@ -867,6 +1017,8 @@ static NOINLINE unsigned logdir_open(struct logdir *ld, const char *fn)
 		if (i == 0) bb_error_msg(INFO"append: %s/current", ld->name);
 		else bb_error_msg(INFO"new: %s/current", ld->name);
 	}
+	/* Pick up files left uncompressed by previous run */
+	compressorstart(ld);
 
 	while (fchdir(fdwdir) == -1)
 		pause1cannot("change to initial working directory");
@@ -957,27 +1109,17 @@ static int buffer_pread(/*int fd, */char *s, unsigned len)
 	} while (!exitasap);
 
 	if (i > 0) {
-		int cnt;
+		char *end;
 		linecomplete = (s[i-1] == '\n');
+		G.stamp_stale = 1;
 		if (!repl)
 			return i;
 
-		cnt = i;
-		while (--cnt >= 0) {
-			char ch = *s;
-			if (ch != '\n') {
-				if (ch < 32 || ch > 126)
-					*s = repl;
-				else {
-					int j;
-					for (j = 0; replace[j]; ++j) {
-						if (ch == replace[j]) {
-							*s = repl;
-							break;
-						}
-					}
-				}
-			}
+		/* One table lookup per char for the whole buffer */
+		end = s + i;
+		while (s != end) {
+			if (G.replmap[(unsigned char)*s])
+				*s = repl;
 			s++;
 		}
 	}
@@ -1005,6 +1147,13 @@ static void sig_child_handler(int sig_no UNUSED_PARAM)
 				processorstop(&dir[l]);
 				break;
 			}
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+			if (dir[l].zpid == pid) {
+				dir[l].zpid = 0;
+				compressorstop(&dir[l]);
+				break;
+			}
+#endif
 		}
 	}
 }
@@ -1068,6 +1217,14 @@ int svlogd_main(int argc, char **argv)
 			bb_show_usage();
 	}
 	if (opt & 2) if (!repl) repl = '_'; // -R
+	if (repl) {
+		const char *p;
+		for (i = 0; i < 256; i++)
+			G.replmap[i] = (i < 32 || i > 126);
+		for (p = replace; *p; p++)
+			G.replmap[(unsigned char)*p] = 1;
+		G.replmap['\n'] = 0;
+	}
 	if (opt & 4) { // -l
 		linemax = xatou_range(l, 0, COMMON_BUFSIZE-26);
 		if (linemax == 0)
@@ -1129,7 +1286,6 @@ int svlogd_main(int argc, char **argv)
 
 	/* Each iteration processes one or more lines */
 	while (1) {
-		char stamp[FMT_PTIME];
 		char *lineptr;
 		char *printptr;
 		char *np;
@@ -1181,13 +1337,17 @@ int svlogd_main(int argc, char **argv)
 		printlen = linelen;
 		printptr = lineptr;
 		if (timestamp) {
-			if (timestamp == 1)
-				fmt_time_bernstein_25(stamp);
-			else /* 2+: */
-				fmt_time_human_30nul(stamp, timestamp == 2 ? '_' : 'T');
+			/* All lines from one read() share the timestamp */
+			if (G.stamp_stale) {
+				if (timestamp == 1)
+					fmt_time_bernstein_25(G.stamp);
+				else /* 2+: */
+					fmt_time_human_30nul(G.stamp, timestamp == 2 ? '_' : 'T');
+				G.stamp_stale = 0;
+			}
 			printlen += 26;
 			printptr -= 26;
-			memcpy(printptr, stamp, 25);
+			memcpy(printptr, G.stamp, 25);
 			printptr[25] = ' ';
 		}
 		for (i = 0; i < dirn; ++i) {
@@ -1255,6 +1415,10 @@ int svlogd_main(int argc, char **argv)
 		if (dir[i].ppid)
 			while (!processorstop(&dir[i]))
 				continue;
+#if ENABLE_FEATURE_SVLOGD_COMPRESS
+		if (dir[i].zpid)
+			compressorstop(&dir[i]);
+#endif
 		logdir_close(&dir[i]);
 	}
 	return 0;
@@ -0,0 +1 @@
+cmd_selinux/built-in.o :=  rm -f selinux/built-in.o; ar rcs selinux/built-in.o
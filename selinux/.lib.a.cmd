@@ -0,0 +1 @@
+cmd_selinux/lib.a := rm -f selinux/lib.a; ar  rcs selinux/lib.a 
@@ -0,0 +1 @@
+cmd_shell/built-in.o :=  rm -f shell/built-in.o; ar rcs shell/built-in.o
@@ -0,0 +1 @@
+cmd_shell/lib.a := rm -f shell/lib.a; ar  rcs shell/lib.a shell/ash.o shell/ash_ptr_hack.o shell/cttyhack.o shell/hush.o shell/match.o shell/math.o shell/random.o shell/shell_common.o
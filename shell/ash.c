@@ -246,6 +246,8 @@
 #define    BASH_READ_D          ENABLE_ASH_BASH_COMPAT
 #define IF_BASH_READ_D              IF_ASH_BASH_COMPAT
 #define    BASH_WAIT_N          ENABLE_ASH_BASH_COMPAT
+/* $(<file) */
+#define    BASH_READ_SUBST      ENABLE_ASH_BASH_COMPAT
 /* <(...) and >(...) */
 #if HAVE_DEV_FD
 # define    BASH_PROCESS_SUBST   ENABLE_ASH_BASH_COMPAT
@@ -322,9 +324,11 @@ typedef long arith_t;
 
 /* ============ Hash table sizes. Configurable. */
 
-#define VTABSIZE 39
+/* Variable and command tables start at these sizes and double
+ * whenever they get more entries than buckets. Must be powers of 2. */
+#define VTABSIZE 64
 #define ATABSIZE 39
-#define CMDTABLESIZE 31         /* should be prime */
+#define CMDTABLESIZE 32
 
 
 /* ============ Shell options */
@@ -2086,6 +2090,8 @@ static void FAST_FUNC getoptsreset(const char *value);
 struct var {
 	struct var *next;               /* next entry in hash list */
 	int flags;                      /* flags are defined above */
+	unsigned hash;                  /* hash of name, see hashname() */
+	unsigned namelen;               /* length of name */
 	const char *var_text;           /* name=value */
 	void (*var_func)(const char *) FAST_FUNC; /* function to be called when  */
 					/* the variable gets set/unset */
@@ -2187,7 +2193,9 @@ struct globals_var {
 	struct shparam shellparam;      /* $@ current positional parameters */
 	struct redirtab *redirlist;
 	int preverrout_fd;   /* stderr fd: usually 2, unless redirect moved it */
-	struct var *vartab[VTABSIZE];
+	struct var **vartab;
+	unsigned vtabsize;              /* number of buckets, power of 2 */
+	unsigned nvars;                 /* number of entries */
 	struct var varinit[ARRAY_SIZE(varinit_data)];
 	int lineno;
 	char linenovar[sizeof("LINENO=") + sizeof(int)*3];
@@ -2202,6 +2210,8 @@ extern struct globals_var *BB_GLOBAL_CONST ash_ptr_to_globals_var;
 //#define redirlist     (G_var.redirlist    )
 #define preverrout_fd (G_var.preverrout_fd)
 #define vartab        (G_var.vartab       )
+#define vtabsize      (G_var.vtabsize     )
+#define nvars         (G_var.nvars        )
 #define varinit       (G_var.varinit      )
 #define lineno        (G_var.lineno       )
 #define linenovar     (G_var.linenovar    )
@@ -2236,6 +2246,8 @@ extern struct globals_var *BB_GLOBAL_CONST ash_ptr_to_globals_var;
 #define INIT_G_var() do { \
 	unsigned i; \
 	XZALLOC_CONST_PTR(&ash_ptr_to_globals_var, sizeof(G_var)); \
+	vtabsize = VTABSIZE; \
+	vartab = xzalloc(VTABSIZE * sizeof(vartab[0])); \
 	for (i = 0; i < ARRAY_SIZE(varinit_data); i++) { \
 		varinit[i].flags    = varinit_data[i].flags; \
 		varinit[i].var_text = varinit_data[i].var_text; \
@@ -2279,17 +2291,44 @@ getoptsreset(const char *value)
 #endif
 
 /*
- * Find the appropriate entry in the hash table from the name.
+ * FNV-1a hash of a name, which ends at NUL or '=' (for "name=value").
+ * Stores the length of the name in *lenp.
  */
-static struct var **
-hashvar(const char *p)
+static unsigned
+hashname(const char *name, unsigned *lenp)
 {
-	unsigned hashval;
+	const char *p = name;
+	unsigned hashval = 2166136261U;
 
-	hashval = ((unsigned char) *p) << 4;
 	while (*p && *p != '=')
-		hashval += (unsigned char) *p++;
-	return &vartab[hashval % VTABSIZE];
+		hashval = (hashval ^ (unsigned char) *p++) * 16777619;
+	*lenp = p - name;
+	return hashval ^ (hashval >> 16);
+}
+
+/*
+ * Double the number of buckets in the variable table.
+ * Entries keep their cached hash, so no string is looked at.
+ */
+static void
+growvartab(void)
+{
+	struct var **newtab;
+	struct var **vpp;
+	struct var *vp, *next;
+	unsigned newsize = vtabsize * 2;
+
+	newtab = ckzalloc(newsize * sizeof(newtab[0]));
+	for (vpp = vartab; vpp < vartab + vtabsize; vpp++) {
+		for (vp = *vpp; vp; vp = next) {
+			next = vp->next;
+			vp->next = newtab[vp->hash & (newsize - 1)];
+			newtab[vp->hash & (newsize - 1)] = vp;
+		}
+	}
+	free(vartab);
+	vartab = newtab;
+	vtabsize = newsize;
 }
 
 static int
@@ -2320,19 +2359,31 @@ initvar(void)
 	vp = varinit;
 	end = vp + ARRAY_SIZE(varinit);
 	do {
-		vpp = hashvar(vp->var_text);
+		vp->hash = hashname(vp->var_text, &vp->namelen);
+		vpp = &vartab[vp->hash & (vtabsize - 1)];
 		vp->next = *vpp;
 		*vpp = vp;
+		nvars++;
 	} while (++vp < end);
 }
 
+/*
+ * Find the appropriate entry in the hash table from the name.
+ * If not found, returns pointer to the NULL link at the end of the chain.
+ */
 static struct var **
 findvar(const char *name)
 {
 	struct var **vpp;
+	struct var *vp;
+	unsigned len;
+	unsigned hashval = hashname(name, &len);
 
-	for (vpp = hashvar(name); *vpp; vpp = &(*vpp)->next) {
-		if (varcmp((*vpp)->var_text, name) == 0) {
+	for (vpp = &vartab[hashval & (vtabsize - 1)]; (vp = *vpp) != NULL; vpp = &vp->next) {
+		if (vp->hash == hashval
+		 && vp->namelen == len
+		 && memcmp(vp->var_text, name, len) == 0
+		) {
 			break;
 		}
 	}
@@ -2440,6 +2491,7 @@ setvareq(char *s, int flags)
 		if (((flags & (VEXPORT|VREADONLY|VSTRFIXED|VUNSET)) | (vp->flags & VSTRFIXED)) == VUNSET) {
 			*vpp = vp->next;
 			free(vp);
+			nvars--;
  out_free:
 			if ((flags & (VTEXTFIXED|VSTACK|VNOSAVE)) == VNOSAVE)
 				free(s);
@@ -2460,7 +2512,10 @@ setvareq(char *s, int flags)
 		vp = ckzalloc(sizeof(*vp));
 		vp->next = *vpp;
 		/*vp->func = NULL; - ckzalloc did it */
+		vp->hash = hashname(s, &vp->namelen);
 		*vpp = vp;
+		if (++nvars > vtabsize)
+			growvartab();
 	}
 	if (!(flags & (VTEXTFIXED|VSTACK|VNOSAVE)))
 		s = ckstrdup(s);
@@ -2568,7 +2623,7 @@ listvars(int on, int off, struct strlist *lp, char ***end)
 #endif
 			}
 		}
-	} while (++vpp < vartab + VTABSIZE);
+	} while (++vpp < vartab + vtabsize);
 
 #if ENABLE_FEATURE_SH_NOFORK
 	while (lp) {
@@ -6564,6 +6619,7 @@ struct backcmd {                /* result of evalbackcmd */
 	int nleft;              /* number of chars in buffer */
 	char *buf;              /* buffer */
 	struct job *jp;         /* job structure for command */
+	int status;             /* exit status if jp is NULL */
 };
 
 /* These forward decls are needed to use "eval" code for backticks handling: */
@@ -6584,6 +6640,7 @@ evaltreenr(union node *n, int flags)
 	bb_unreachable(abort());
 	/* NOTREACHED */
 }
+static int evalbackcmd_nofork(union node *n, struct backcmd *result);
 
 static void FAST_FUNC
 evalbackcmd(union node *n, struct backcmd *result
@@ -6605,9 +6662,12 @@ evalbackcmd(union node *n, struct backcmd *result
 	result->buf = NULL;
 	result->nleft = 0;
 	result->jp = NULL;
+	result->status = 0;
 	if (n == NULL) {
 		goto out;
 	}
+	if (ctl == CTLBACKQ && evalbackcmd_nofork(n, result))
+		goto out;
 
 	if (pipe(pip) < 0)
 		ash_msg_and_raise_perror("can't create pipe");
@@ -6707,7 +6767,7 @@ expbackq(union node *cmd, int flag IF_BASH_PROCESS_SUBST(, int ctl))
 	free(in.buf);
 	if (in.fd >= 0) {
 		close(in.fd);
-		back_exitstatus = waitforjob(in.jp);
+		back_exitstatus = in.jp ? waitforjob(in.jp) : in.status;
 	}
  done:
 	INT_ON;
@@ -8250,13 +8310,17 @@ static void find_command(char *, struct cmdentry *, int, const char *);
 struct tblentry {
 	struct tblentry *next;  /* next entry in hash chain */
 	union param param;      /* definition of builtin function */
+	unsigned hash;          /* hash of cmdname, see hashname() */
 	smallint cmdtype;       /* CMDxxx */
 	char rehash;            /* if set, cd done since entry created */
 	char cmdname[1];        /* name of command */
 };
 
 static struct tblentry **cmdtable;
+static unsigned cmdtabsize;     /* number of buckets, power of 2 */
+static unsigned ncmds;          /* number of entries */
 #define INIT_G_cmdtable() do { \
+	cmdtabsize = CMDTABLESIZE; \
 	cmdtable = xzalloc(CMDTABLESIZE * sizeof(cmdtable[0])); \
 } while (0)
 
@@ -8407,7 +8471,7 @@ clearcmdentry(void)
 	struct tblentry *cmdp;
 
 	INT_OFF;
-	for (tblp = cmdtable; tblp < &cmdtable[CMDTABLESIZE]; tblp++) {
+	for (tblp = cmdtable; tblp < &cmdtable[cmdtabsize]; tblp++) {
 		pp = tblp;
 		while ((cmdp = *pp) != NULL) {
 			if (cmdp->cmdtype == CMDNORMAL
@@ -8418,6 +8482,7 @@ clearcmdentry(void)
 			) {
 				*pp = cmdp->next;
 				free(cmdp);
+				ncmds--;
 			} else {
 				pp = &cmdp->next;
 			}
@@ -8437,33 +8502,60 @@ clearcmdentry(void)
  */
 static struct tblentry **lastcmdentry;
 
+/*
+ * Double the number of buckets in the command table.
+ */
+static void
+growcmdtable(void)
+{
+	struct tblentry **newtab;
+	struct tblentry **pp;
+	struct tblentry *cmdp, *next;
+	unsigned newsize = cmdtabsize * 2;
+
+	newtab = ckzalloc(newsize * sizeof(newtab[0]));
+	for (pp = cmdtable; pp < &cmdtable[cmdtabsize]; pp++) {
+		for (cmdp = *pp; cmdp; cmdp = next) {
+			next = cmdp->next;
+			cmdp->next = newtab[cmdp->hash & (newsize - 1)];
+			newtab[cmdp->hash & (newsize - 1)] = cmdp;
+		}
+	}
+	free(cmdtable);
+	cmdtable = newtab;
+	cmdtabsize = newsize;
+}
+
 static struct tblentry *
 cmdlookup(const char *name, int add)
 {
-	unsigned int hashval;
-	const char *p;
+	unsigned hashval;
+	unsigned len;
 	struct tblentry *cmdp;
 	struct tblentry **pp;
 
-	p = name;
-	hashval = (unsigned char)*p << 4;
-	while (*p)
-		hashval += (unsigned char)*p++;
-	hashval &= 0x7FFF;
-	pp = &cmdtable[hashval % CMDTABLESIZE];
+	/* Grow before lookup: lastcmdentry must stay valid */
+	if (add && ncmds >= cmdtabsize)
+		growcmdtable();
+	hashval = hashname(name, &len);
+	if (name[len] != '\0') /* "a=b" is a valid command name */
+		len += strlen(name + len);
+	pp = &cmdtable[hashval & (cmdtabsize - 1)];
 	for (cmdp = *pp; cmdp; cmdp = cmdp->next) {
-		if (strcmp(cmdp->cmdname, name) == 0)
+		if (cmdp->hash == hashval && strcmp(cmdp->cmdname, name) == 0)
 			break;
 		pp = &cmdp->next;
 	}
 	if (add && cmdp == NULL) {
 		cmdp = *pp = ckzalloc(sizeof(struct tblentry)
-				+ strlen(name)
+				+ len
 				/* + 1 - already done because
 				 * tblentry::cmdname is char[1] */);
 		/*cmdp->next = NULL; - ckzalloc did it */
+		cmdp->hash = hashval;
 		cmdp->cmdtype = CMDUNKNOWN;
-		strcpy(cmdp->cmdname, name);
+		memcpy(cmdp->cmdname, name, len);
+		ncmds++;
 	}
 	lastcmdentry = pp;
 	return cmdp;
@@ -8483,6 +8575,7 @@ delete_cmd_entry(void)
 	if (cmdp->cmdtype == CMDFUNCTION)
 		freefunc(cmdp->param.func);
 	free(cmdp);
+	ncmds--;
 	INT_ON;
 }
 
@@ -8519,7 +8612,7 @@ hashcmd(int argc UNUSED_PARAM, char **argv UNUSED_PARAM)
 	}
 
 	if (*argptr == NULL) {
-		for (pp = cmdtable; pp < &cmdtable[CMDTABLESIZE]; pp++) {
+		for (pp = cmdtable; pp < &cmdtable[cmdtabsize]; pp++) {
 			for (cmdp = *pp; cmdp; cmdp = cmdp->next) {
 				if (cmdp->cmdtype == CMDNORMAL)
 					printentry(cmdp);
@@ -8559,7 +8652,7 @@ hashcd(void)
 	struct tblentry **pp;
 	struct tblentry *cmdp;
 
-	for (pp = cmdtable; pp < &cmdtable[CMDTABLESIZE]; pp++) {
+	for (pp = cmdtable; pp < &cmdtable[cmdtabsize]; pp++) {
 		for (cmdp = *pp; cmdp; cmdp = cmdp->next) {
 			if (cmdp->cmdtype == CMDNORMAL
 			 || (cmdp->cmdtype == CMDBUILTIN
@@ -10305,7 +10398,7 @@ ash_command_name(int i)
 		return builtintab[i].name + 1;
 	i -= ARRAY_SIZE(builtintab);
 
-	for (n = 0; n < CMDTABLESIZE; n++) {
+	for (n = 0; n < cmdtabsize; n++) {
 		struct tblentry *cmdp;
 		for (cmdp = cmdtable[n]; cmdp; cmdp = cmdp->next) {
 			if (cmdp->cmdtype == CMDFUNCTION && --i < 0)
@@ -10707,6 +10800,193 @@ prehash(union node *n)
 		find_command(n->ncmd.args->narg.text, &entry, 0, pathval());
 }
 
+/*
+ * Can the word be expanded in the parent instead of the subshell?
+ * Not if it contains $(...), $((...)), ${v=...} or ${v?...}:
+ * those would change our state or could abort the shell.
+ */
+static int
+expand_is_pure(union node *argp)
+{
+	const char *p;
+
+	if (argp->narg.backquote)
+		return 0;
+	for (p = argp->narg.text; *p; p++) {
+		switch ((unsigned char)*p) {
+		case CTLESC:
+			p++;
+			break;
+		case CTLVAR: {
+			int subtype = (unsigned char)*++p & VSTYPE;
+			if (subtype == VSASSIGN || subtype == VSQUESTION)
+				return 0;
+			break;
+		}
+		case CTLARI:
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * expandarg() for use while another word is being expanded:
+ * saves and restores the expansion state of the outer word.
+ */
+static void
+expandarg_nested(union node *arg, struct arglist *arglist, int flag)
+{
+	char *sv_expdest = expdest;
+	struct nodelist *sv_argbackq = argbackq;
+	struct ifsregion sv_ifsfirst = ifsfirst;
+	struct ifsregion *sv_ifslastp = ifslastp;
+
+	ifsfirst.next = NULL;
+	ifslastp = NULL;
+	expandarg(arg, arglist, flag);
+	ifsfirst = sv_ifsfirst;
+	ifslastp = sv_ifslastp;
+	argbackq = sv_argbackq;
+	expdest = sv_expdest;
+}
+
+/*
+ * Command substitution without fork. Handles $(<FILE), and commands
+ * which only print something: echo, printf, test, pwd builtins
+ * and (if standalone shell runs them in-process anyway) NOFORK applets.
+ * Their output goes to a memfd which the caller reads back.
+ * Returns 0 if the subshell needs to be forked after all.
+ */
+static int
+evalbackcmd_nofork(union node *n, struct backcmd *result)
+{
+	struct arglist arglist;
+	union node *argp;
+	int fd;
+
+	/* "set -x" tracing and "set -u" errors would differ, don't bother */
+	if (n->type != NCMD || n->ncmd.assign || xflag || uflag)
+		return 0;
+
+	arglist.list = NULL;
+	arglist.lastp = &arglist.list;
+	argp = n->ncmd.args;
+	if (!argp) {
+#if BASH_READ_SUBST
+		/* $(<FILE): just open FILE, no need to copy it */
+		union node *redir = n->ncmd.redirect;
+
+		if (!redir || redir->nfile.next
+		 || redir->type != NFROM || redir->nfile.fd != 0
+		 || !expand_is_pure(redir->nfile.fname)
+		) {
+			return 0;
+		}
+		expandarg_nested(redir->nfile.fname, &arglist, EXP_TILDE | EXP_REDIR);
+		fd = open(arglist.list->text, O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return 0; /* let subshell report the error */
+		result->fd = fd;
+		return 1;
+#else
+		return 0;
+#endif
+	}
+#ifdef MFD_CLOEXEC
+	if (n->ncmd.redirect || !goodname(argp->narg.text))
+		return 0;
+	{
+		struct cmdentry entry;
+		struct strlist *sp;
+		char **argv, **ap;
+		const struct builtincmd *bcmd = NULL;
+# if ENABLE_FEATURE_SH_STANDALONE && ENABLE_FEATURE_SH_NOFORK && NUM_APPLETS > 1
+		int applet_no = -1;
+# endif
+		int savefd1;
+		int sv_exitstatus;
+		int i;
+
+		find_command(argp->narg.text, &entry, DO_REGBLTIN, pathval());
+		if (entry.cmdtype == CMDBUILTIN) {
+			bcmd = entry.u.cmd;
+			if (bcmd->builtin != pwdcmd
+			 IF_ASH_ECHO(&& bcmd->builtin != echocmd)
+			 IF_ASH_PRINTF(&& bcmd->builtin != printfcmd)
+			 IF_ASH_TEST(&& bcmd->builtin != testcmd)
+			) {
+				return 0;
+			}
+		}
+# if ENABLE_FEATURE_SH_STANDALONE && ENABLE_FEATURE_SH_NOFORK && NUM_APPLETS > 1
+		else if (entry.cmdtype == CMDNORMAL) {
+			/* find_command() encodes applet_no as (-2 - applet_no) */
+			applet_no = (- entry.u.index - 2);
+			if (applet_no < 0 || !APPLET_IS_NOFORK(applet_no))
+				return 0;
+		}
+# endif
+		else
+			return 0;
+
+		for (; argp; argp = argp->narg.next) {
+			if (!expand_is_pure(argp))
+				return 0;
+		}
+
+		fd = memfd_create("backq", MFD_CLOEXEC);
+		if (fd < 0)
+			return 0;
+
+		for (argp = n->ncmd.args; argp; argp = argp->narg.next)
+			expandarg_nested(argp, &arglist, EXP_FULL | EXP_TILDE);
+		i = 0;
+		for (sp = arglist.list; sp; sp = sp->next)
+			i++;
+		argv = ap = stalloc(sizeof(char *) * (i + 1));
+		for (sp = arglist.list; sp; sp = sp->next)
+			*ap++ = sp->text;
+		*ap = NULL;
+
+		flush_stdout_stderr();
+		savefd1 = dup_CLOEXEC(1, 9);
+		dup2(fd, 1);
+		sv_exitstatus = exitstatus;
+		i = 0;
+		if (bcmd) {
+			i = evalbltin(bcmd, ap - argv, argv, 0);
+		}
+# if ENABLE_FEATURE_SH_STANDALONE && ENABLE_FEATURE_SH_NOFORK && NUM_APPLETS > 1
+		else {
+			char **sv_environ = environ;
+			environ = listvars(VEXPORT, VUNSET, NULL, /*end:*/ NULL);
+			exitstatus = run_nofork_applet(applet_no, argv);
+			environ = sv_environ;
+		}
+# endif
+		if (savefd1 >= 0) {
+			dup2(savefd1, 1);
+			close(savefd1);
+		} else {
+			close(1);
+		}
+		result->status = exitstatus;
+		exitstatus = sv_exitstatus;
+		if (i && exception_type != EXERROR) {
+			/* ^C and such */
+			close(fd);
+			longjmp(exception_handler->loc, 1);
+		}
+		lseek(fd, 0, SEEK_SET);
+		result->fd = fd;
+		return 1;
+	}
+#else
+	return 0;
+#endif
+}
+
 
 /* ============ Builtin commands
  *
@@ -780,6 +780,8 @@ struct variable {
 	smallint flg_export; /* putenv should be done on this var */
 	smallint flg_read_only;
 };
+/* Must be a power of 2 */
+#define VAR_CACHE_SIZE 64
 
 enum {
 	BC_BREAK = 1,
@@ -965,6 +967,14 @@ struct globals {
 	char *ifs_whitespace; /* = G.ifs or malloced */
 	const char *cwd;
 	struct variable *top_var;
+	/* Lookup cache for G.top_var. A slot is valid only while
+	 * var_gen is unchanged: any insertion/removal bumps it.
+	 */
+	unsigned var_gen;
+	struct {
+		struct variable *var;
+		unsigned gen;
+	} var_cache[VAR_CACHE_SIZE];
 	char **expanded_assignments;
 	struct variable **shadowed_vars_pp;
 	unsigned var_nest_level;
@@ -2265,6 +2275,35 @@ static const char *get_cwd(int force)
 /*
  * Shell and environment variable support
  */
+static void var_list_changed(void)
+{
+	if (++G.var_gen == 0) /* wrapped: old slots could look valid */
+		memset(G.var_cache, 0, sizeof(G.var_cache));
+}
+
+/* Hash of "NAME" or "NAME=VAL" (up to '=') */
+static unsigned var_cache_idx(const char *name)
+{
+	unsigned h = 0;
+	while (*name != '\0' && *name != '=')
+		h = (h * 31) + (unsigned char)*name++;
+	return (h ^ (h >> 7)) & (VAR_CACHE_SIZE - 1);
+}
+
+/* Returns the variable get_ptr_to_local_var() would find,
+ * or NULL if it is not in the cache (caller should search the list).
+ */
+static struct variable *var_cache_lookup(const char *name, unsigned idx)
+{
+	struct variable *cur = G.var_cache[idx].var;
+	if (cur && G.var_cache[idx].gen == G.var_gen
+	 && varcmp(cur->varstr, name) == 0
+	) {
+		return cur;
+	}
+	return NULL;
+}
+
 static struct variable **get_ptr_to_local_var(const char *name)
 {
 	struct variable **pp;
@@ -2282,6 +2321,8 @@ static struct variable **get_ptr_to_local_var(const char *name)
 static const char* FAST_FUNC get_local_var_value(const char *name)
 {
 	struct variable **vpp;
+	struct variable *cur;
+	unsigned idx;
 
 	if (G.expanded_assignments) {
 		char **cpp = G.expanded_assignments;
@@ -2293,9 +2334,18 @@ static const char* FAST_FUNC get_local_var_value(const char *name)
 		}
 	}
 
-	vpp = get_ptr_to_local_var(name);
-	if (vpp)
-		return strchr((*vpp)->varstr, '=') + 1;
+	idx = var_cache_idx(name);
+	cur = var_cache_lookup(name, idx);
+	if (!cur) {
+		vpp = get_ptr_to_local_var(name);
+		if (vpp) {
+			cur = *vpp;
+			G.var_cache[idx].var = cur;
+			G.var_cache[idx].gen = G.var_gen;
+		}
+	}
+	if (cur)
+		return strchr(cur->varstr, '=') + 1;
 
 	if (strcmp(name, "PPID") == 0)
 		return utoa(G.root_ppid);
@@ -2363,12 +2413,16 @@ static int set_local_var(char *str, unsigned flags)
 
 	name_len = eq_sign - str + 1; /* including '=' */
 	cur_pp = &G.top_var;
+	cur = var_cache_lookup(str, var_cache_idx(str));
+	/* Shadowing needs real cur_pp, find it the slow way */
+	if (cur && cur->var_nest_level >= local_lvl)
+		goto found;
 	while ((cur = *cur_pp) != NULL) {
 		if (strncmp(cur->varstr, str, name_len) != 0) {
 			cur_pp = &cur->next;
 			continue;
 		}
-
+ found:
 		/* We found an existing var with this name */
 		if (cur->flg_read_only) {
 			bb_error_msg("%s: readonly variable", str);
@@ -2401,6 +2455,7 @@ static int set_local_var(char *str, unsigned flags)
 			 * Remove it from global variable list:
 			 */
 			*cur_pp = cur->next;
+			var_list_changed();
 			if (G.shadowed_vars_pp) {
 				/* Save in "shadowed" list */
 				debug_printf_env("shadowing %s'%s'/%u by '%s'/%u\n",
@@ -2457,6 +2512,7 @@ static int set_local_var(char *str, unsigned flags)
 	cur->var_nest_level = local_lvl;
 	cur->next = *cur_pp;
 	*cur_pp = cur;
+	var_list_changed();
 
  set_str_and_exp:
 	cur->varstr = str;
@@ -2520,6 +2576,7 @@ static int unset_local_var(const char *name)
 			}
 
 			*cur_pp = cur->next;
+			var_list_changed();
 			debug_printf_env("%s: unsetenv '%s'\n", __func__, cur->varstr);
 			bb_unsetenv(cur->varstr);
 			if (!cur->max_len)
@@ -2550,6 +2607,7 @@ static void add_vars(struct variable *var)
 		next = var->next;
 		var->next = G.top_var;
 		G.top_var = var;
+		var_list_changed();
 		if (var->flg_export) {
 			debug_printf_env("%s: restoring exported '%s'/%u\n", __func__, var->varstr, var->var_nest_level);
 			putenv(var->varstr);
@@ -3328,7 +3386,12 @@ static int glob_needed(const char *s)
 			s += 2;
 			continue;
 		}
-		if (*s == '*' || *s == '[' || *s == '?' || *s == '{')
+		if (*s == '*' || *s == '?' || *s == '{')
+			return 1;
+		/* "[" without "]" after it is not a bracket expression.
+		 * Not globbing it saves a directory scan on every "[ ... ]"
+		 */
+		if (*s == '[' && strchr(s + 1, ']'))
 			return 1;
 		s++;
 	}
@@ -3519,7 +3582,9 @@ static int glob_needed(const char *s)
 			s += 2;
 			continue;
 		}
-		if (*s == '*' || *s == '[' || *s == '?')
+		if (*s == '*' || *s == '?')
+			return 1;
+		if (*s == '[' && strchr(s + 1, ']'))
 			return 1;
 		s++;
 	}
@@ -8308,6 +8373,7 @@ static void remove_nested_vars(void)
 		}
 		/* Remove from global list */
 		*cur_pp = cur->next;
+		var_list_changed();
 		/* Free */
 		if (!cur->max_len) {
 			debug_printf_env("freeing nested '%s'/%u\n", cur->varstr, cur->var_nest_level);
@@ -43,6 +43,112 @@ int FAST_FUNC varcmp(const char *p, const char *q)
 
 /* read builtin */
 
+/* "read" must not consume input past the delimiter: the rest belongs
+ * to whoever reads the fd next. Reading one byte per read() is slow,
+ * so when we can give back what we did not use, we read in blocks:
+ * regular files are lseek'ed back, pipes are peeked at with tee()
+ * and only the used part is then read out of them.
+ */
+enum {
+	RDBUF_BYTE = 0, /* one byte per read() */
+	RDBUF_SEEK,
+	RDBUF_PEEK,
+	RDBUF_MAX = 4 * 1024,
+};
+struct read_buf {
+	int fd;
+	int mode;
+	int pos, len;
+	int blksize;
+#ifdef SPLICE_F_NONBLOCK
+	int peek_fd[2];
+#endif
+	char blk[RDBUF_MAX];
+};
+
+static void rdbuf_init(struct read_buf *rb, int fd)
+{
+	struct stat st;
+
+	rb->fd = fd;
+	rb->mode = RDBUF_BYTE;
+	rb->pos = rb->len = 0;
+	rb->blksize = 128; /* grows if lines are long */
+	if (fstat(fd, &st) != 0)
+		return;
+	if (S_ISREG(st.st_mode)) {
+		if (lseek(fd, 0, SEEK_CUR) >= 0)
+			rb->mode = RDBUF_SEEK;
+		return;
+	}
+#ifdef SPLICE_F_NONBLOCK
+	if (S_ISFIFO(st.st_mode) && pipe2(rb->peek_fd, O_CLOEXEC) == 0)
+		rb->mode = RDBUF_PEEK;
+#endif
+}
+
+/* Give back (or, for pipes, take out) what we did not (did) use */
+static void rdbuf_release(struct read_buf *rb)
+{
+	if (rb->mode == RDBUF_SEEK) {
+		if (rb->len - rb->pos != 0)
+			lseek(rb->fd, rb->pos - rb->len, SEEK_CUR);
+	}
+#ifdef SPLICE_F_NONBLOCK
+	else if (rb->mode == RDBUF_PEEK) {
+		if (rb->pos != 0)
+			full_read(rb->fd, rb->blk, rb->pos);
+	}
+#endif
+	rb->pos = rb->len = 0;
+}
+
+/* Call with empty buffer (after rdbuf_release).
+ * Returns number of bytes now buffered, 0 on EOF, <0 on error.
+ */
+static int rdbuf_fill(struct read_buf *rb)
+{
+	int n;
+
+	n = 1;
+	if (rb->mode != RDBUF_BYTE) {
+		n = rb->blksize;
+		if (n < RDBUF_MAX)
+			rb->blksize = n * 2;
+	}
+#ifdef SPLICE_F_NONBLOCK
+	if (rb->mode == RDBUF_PEEK) {
+		/* Copy (not move) pipe data into our private pipe */
+		n = tee(rb->fd, rb->peek_fd[1], n, SPLICE_F_NONBLOCK);
+		if (n > 0)
+			return (rb->len = full_read(rb->peek_fd[0], rb->blk, n));
+		if (n == 0 || errno != EINVAL)
+			return n;
+		/* Can't tee this one */
+		close(rb->peek_fd[0]);
+		close(rb->peek_fd[1]);
+		rb->mode = RDBUF_BYTE;
+		n = 1;
+	}
+#endif
+	/* Not safe_read: we must return EINTR to the caller */
+	n = read(rb->fd, rb->blk, n);
+	if (n > 0)
+		rb->len = n;
+	return n;
+}
+
+static void rdbuf_done(struct read_buf *rb)
+{
+	rdbuf_release(rb);
+#ifdef SPLICE_F_NONBLOCK
+	if (rb->mode == RDBUF_PEEK) {
+		close(rb->peek_fd[0]);
+		close(rb->peek_fd[1]);
+	}
+#endif
+}
+
 /* Needs to be interruptible: shell must handle traps and shell-special signals
  * while inside read. To implement this, be sure to not loop on EINTR
  * and return errno == EINTR reliably.
@@ -56,6 +162,7 @@ shell_builtin_read(struct builtin_read_params *params)
 {
 	struct pollfd pfd[1];
 #define fd (pfd[0].fd) /* -u FD */
+	struct read_buf rb;
 	unsigned err;
 	unsigned end_ms; /* -t TIMEOUT */
 	int nchars; /* -n NUM */
@@ -189,6 +296,7 @@ shell_builtin_read(struct builtin_read_params *params)
 	buffer = NULL;
 	bufpos = 0;
 	delim = params->opt_d ? params->opt_d[0] : '\n';
+	rdbuf_init(&rb, fd);
 	do {
 		char c;
 		int timeout;
@@ -196,6 +304,11 @@ shell_builtin_read(struct builtin_read_params *params)
 		if ((bufpos & 0xff) == 0)
 			buffer = xrealloc(buffer, bufpos + 0x101);
 
+		if (rb.pos < rb.len)
+			goto have_char;
+		/* Before poll: peeked pipe data would make it return at once */
+		rdbuf_release(&rb);
+
 		timeout = -1;
 		if (params->opt_t) {
 			timeout = end_ms - (unsigned)monotonic_ms();
@@ -222,13 +335,13 @@ shell_builtin_read(struct builtin_read_params *params)
 			retval = (const char *)(uintptr_t)1;
 			goto ret;
 		}
-		if (read(fd, &buffer[bufpos], 1) != 1) {
+		if (rdbuf_fill(&rb) <= 0) {
 			err = errno;
 			retval = (const char *)(uintptr_t)1;
 			break;
 		}
-
-		c = buffer[bufpos];
+ have_char:
+		c = buffer[bufpos] = rb.blk[rb.pos++];
 		if (!(read_flags & BUILTIN_READ_RAW)) {
 			if (backslash) {
 				backslash = 0;
@@ -328,6 +441,7 @@ shell_builtin_read(struct builtin_read_params *params)
 	}
 
  ret:
+	rdbuf_done(&rb);
 	free(buffer);
 	if (read_flags & BUILTIN_READ_SILENT)
 		tcsetattr(fd, TCSANOW, &old_tty);
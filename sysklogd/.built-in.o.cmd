@@ -0,0 +1 @@
+cmd_sysklogd/built-in.o :=  rm -f sysklogd/built-in.o; ar rcs sysklogd/built-in.o
@@ -18,18 +18,6 @@
 //config:	certainly want to enable this feature as well. This
 //config:	utility will allow you to read the messages that are
 //config:	stored in the syslogd circular buffer.
-//config:
-//config:config FEATURE_LOGREAD_REDUCED_LOCKING
-//config:	bool "Double buffering"
-//config:	default y
-//config:	depends on LOGREAD
-//config:	help
-//config:	'logread' output to slow serial terminals can have
-//config:	side effects on syslog because of the semaphore.
-//config:	This option make logread to double buffer copy
-//config:	from circular buffer, minimizing semaphore
-//config:	contention at some minor memory expense.
-//config:
 
 //applet:IF_LOGREAD(APPLET(logread, BB_DIR_SBIN, BB_SUID_DROP))
 
@@ -43,186 +31,135 @@
 //usage:     "\n	-F	Same as -f, but dump buffer first"
 
 #include "libbb.h"
-#include "common_bufsiz.h"
 #include <sys/ipc.h>
-#include <sys/sem.h>
 #include <sys/shm.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 
 #define DEBUG 0
 
-/* our shared key (syslogd.c and logread.c must be in sync) */
+/* our shared key and layout (syslogd.c and logread.c must be in sync) */
 enum { KEY_ID = 0x414e4547 }; /* "GENA" */
+enum { SHBUF_MAGIC = 0x4c4f4732 }; /* "LOG2" */
 
+/* See syslogd.c for the description of the lock-free protocol */
 struct shbuf_ds {
-	int32_t size;           // size of data - 1
-	int32_t tail;           // end of message list
-	char data[1];           // messages
-};
-
-static const struct sembuf init_sem[3] = {
-	{0, -1, IPC_NOWAIT | SEM_UNDO},
-	{1, 0}, {0, +1, SEM_UNDO}
+	uint32_t magic;             /* SHBUF_MAGIC */
+	uint32_t size;              /* size of data[], power of 2 */
+	volatile uint32_t reserve;  /* data up to here may be overwritten */
+	volatile uint32_t commit;   /* data up to here is valid */
+	char data[];                /* messages */
 };
 
-struct globals {
-	struct sembuf SMrup[1]; // {0, -1, IPC_NOWAIT | SEM_UNDO},
-	struct sembuf SMrdn[2]; // {1, 0}, {0, +1, SEM_UNDO}
-	struct shbuf_ds *shbuf;
-} FIX_ALIASING;
-#define G (*(struct globals*)bb_common_bufsiz1)
-#define SMrup (G.SMrup)
-#define SMrdn (G.SMrdn)
-#define shbuf (G.shbuf)
-#define INIT_G() do { \
-	setup_common_bufsiz(); \
-	memcpy(SMrup, init_sem, sizeof(init_sem)); \
-} while (0)
-
-#if 0
-static void error_exit(const char *str) NORETURN;
-static void error_exit(const char *str)
-{
-	/* Release all acquired resources */
-	shmdt(shbuf);
-	bb_perror_msg_and_die(str);
-}
-#else
-/* On Linux, shmdt is not mandatory on exit */
-# define error_exit(str) bb_simple_perror_msg_and_die(str)
-#endif
-
-/*
- * sem_up - up()'s a semaphore.
- */
-static void sem_up(int semid)
-{
-	if (semop(semid, SMrup, 1) == -1)
-		error_exit("semop[SMrup]");
-}
-
 static void interrupted(int sig)
 {
 	/* shmdt(shbuf); - on Linux, shmdt is not mandatory on exit */
 	kill_myself_with_sig(sig);
 }
 
+/* Sleep until syslogd commits past 'pos' */
+static void wait_for_data(const struct shbuf_ds *shbuf, uint32_t pos)
+{
+	if (syscall(__NR_futex, &shbuf->commit, FUTEX_WAIT, pos, NULL, NULL, 0) != 0
+	 && errno != EAGAIN && errno != EINTR
+	) {
+		/* No futexes? Poll */
+		sleep1();
+	}
+}
+
 int logread_main(int argc, char **argv) MAIN_EXTERNALLY_VISIBLE;
 int logread_main(int argc UNUSED_PARAM, char **argv)
 {
-	unsigned cur;
-	int log_semid; /* ipc semaphore id */
+	const struct shbuf_ds *shbuf;
+	char *copy;
+	unsigned size;
+	uint32_t cur;
 	int log_shmid; /* ipc shared memory id */
 	int follow = getopt32(argv, "fF");
 
-	INIT_G();
-
 	log_shmid = shmget(KEY_ID, 0, 0);
 	if (log_shmid == -1)
 		bb_perror_msg_and_die("can't %s syslogd buffer", "find");
 
 	/* Attach shared memory to our char* */
 	shbuf = shmat(log_shmid, NULL, SHM_RDONLY);
-	if (shbuf == NULL)
+	if (shbuf == (void*) -1L)
 		bb_perror_msg_and_die("can't %s syslogd buffer", "access");
-
-	log_semid = semget(KEY_ID, 0, 0);
-	if (log_semid == -1)
-		error_exit("can't get access to semaphores for syslogd buffer");
+	size = shbuf->size;
+	if (shbuf->magic != SHBUF_MAGIC || (size & (size - 1)))
+		bb_error_msg_and_die("unknown syslogd buffer format");
 
 	bb_signals(BB_FATAL_SIGS, interrupted);
 
-	/* Suppose atomic memory read */
-	/* Max possible value for tail is shbuf->size - 1 */
-	cur = shbuf->tail;
+	copy = xmalloc(size);
+	cur = shbuf->commit;
+	if (!(follow & 1)) /* not -f: start from the oldest data */
+		cur -= size;
 
 	/* Loop for -f or -F, one pass otherwise */
-	do {
-		unsigned shbuf_size;
-		unsigned shbuf_tail;
-		const char *shbuf_data;
-#if ENABLE_FEATURE_LOGREAD_REDUCED_LOCKING
-		int i;
-		int len_first_part;
-		int len_total = len_total; /* for gcc */
-		char *copy = copy; /* for gcc */
-#endif
-		if (semop(log_semid, SMrdn, 2) == -1)
-			error_exit("semop[SMrdn]");
-
-		/* Copy the info, helps gcc to realize that it doesn't change */
-		shbuf_size = shbuf->size;
-		shbuf_tail = shbuf->tail;
-		shbuf_data = shbuf->data; /* pointer! */
+	for (;;) {
+		uint32_t end, oldest;
+		unsigned mask = size - 1;
+		unsigned ofs, len, k, i;
+		char *p;
 
-		if (DEBUG)
-			printf("cur:%u tail:%u size:%u\n",
-					cur, shbuf_tail, shbuf_size);
-
-		if (!(follow & 1)) { /* not -f */
-			/* if -F, "convert" it to -f, so that we don't
-			 * dump the entire buffer on each iteration
-			 */
-			follow >>= 1;
+		end = shbuf->commit;
+		__sync_synchronize();
 
-			/* advance to oldest complete message */
-			/* find NUL */
-			cur += strlen(shbuf_data + cur);
-			if (cur >= shbuf_size) { /* last byte in buffer? */
-				cur = strnlen(shbuf_data, shbuf_tail);
-				if (cur == shbuf_tail)
-					goto unlock; /* no complete messages */
-			}
-			/* advance to first byte of the message */
-			cur++;
-			if (cur >= shbuf_size) /* last byte in buffer? */
-				cur = 0;
-		} else { /* -f */
-			if (cur == shbuf_tail) {
-				sem_up(log_semid);
-				fflush_all();
-				sleep1(); /* TODO: replace me with a sleep_on */
-				continue;
-			}
-		}
-
-		/* Read from cur to tail */
-#if ENABLE_FEATURE_LOGREAD_REDUCED_LOCKING
-		len_first_part = len_total = shbuf_tail - cur;
-		if (len_total < 0) {
-			/* message wraps: */
-			/* [SECOND PART.........FIRST PART] */
-			/*  ^data      ^tail    ^cur      ^size */
-			len_total += shbuf_size;
-		}
-		copy = xmalloc(len_total + 1);
-		if (len_first_part < 0) {
-			/* message wraps (see above) */
-			len_first_part = shbuf_size - cur;
-			memcpy(copy + len_first_part, shbuf_data, shbuf_tail);
+		if (DEBUG)
+			printf("cur:%u commit:%u size:%u\n",
+					(unsigned)cur, (unsigned)end, size);
+
+		if (cur == end) {
+			if (!follow)
+				break;
+			fflush_all();
+			wait_for_data(shbuf, end);
+			continue;
 		}
-		memcpy(copy, shbuf_data + cur, len_first_part);
-		copy[len_total] = '\0';
-		cur = shbuf_tail;
-#else
-		while (cur != shbuf_tail) {
-			fputs_stdout(shbuf_data + cur);
-			cur += strlen(shbuf_data + cur) + 1;
-			if (cur >= shbuf_size)
-				cur = 0;
+		/* Did we fall behind by more than the buffer size? */
+		if (end - cur > size)
+			cur = end - size;
+
+		/* Copy out [cur, end) without any locking... */
+		len = end - cur;
+		ofs = cur & mask;
+		k = size - ofs;
+		if (k > len)
+			k = len;
+		memcpy(copy, shbuf->data + ofs, k);
+		memcpy(copy + k, shbuf->data, len - k);
+		__sync_synchronize();
+
+		/* ...and drop what syslogd could overwrite meanwhile.
+		 * We then start on a message boundary: the first full
+		 * message after the skipped part (or the first message
+		 * found if we start at an arbitrary point in the ring) */
+		i = 0;
+		oldest = shbuf->reserve - size;
+		if ((int32_t)(oldest - cur) > 0)
+			i = oldest - cur;
+		if (i != 0 || !(follow & 1)) {
+			p = memchr(copy + i, '\0', len - i);
+			i = p ? p - copy + 1 : len;
 		}
-#endif
- unlock:
-		/* release the lock on the log chain */
-		sem_up(log_semid);
-
-#if ENABLE_FEATURE_LOGREAD_REDUCED_LOCKING
-		for (i = 0; i < len_total; i += strlen(copy + i) + 1) {
-			fputs_stdout(copy + i);
+		/* if -F, "convert" it to -f, so that we don't
+		 * dump the entire buffer on each iteration */
+		if (!(follow & 1))
+			follow >>= 1;
+
+		while (i < len) {
+			p = copy + i;
+			/* Every message is NUL-terminated: i < len guarantees
+			 * there is a NUL at or before copy[len-1] */
+			fputs_stdout(p);
+			i += strlen(p) + 1;
 		}
-		free(copy);
-#endif
-		fflush_all();
-	} while (follow);
+		cur = end;
+		if (!follow)
+			break;
+	}
 
 	/* shmdt(shbuf); - on Linux, shmdt is not mandatory on exit */
 
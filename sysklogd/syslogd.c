@@ -49,6 +49,22 @@
 //config:	measure to prevent system logs from being tampered with
 //config:	by an intruder.
 //config:
+//config:config FEATURE_REMOTE_LOG_TCP
+//config:	bool "Reliable TCP forwarding (-R tcp://HOST)"
+//config:	default y
+//config:	depends on FEATURE_REMOTE_LOG && FEATURE_SYSLOGD_BATCH
+//config:	help
+//config:	Forward messages over TCP in RFC 5424 format with
+//config:	octet-counted framing (RFC 6587). Messages are batched,
+//config:	and with -Q DIR, what can't be delivered is spooled
+//config:	to disk and replayed after reconnect.
+//config:
+//config:config FEATURE_REMOTE_LOG_SPOOL_SIZE
+//config:	int "Max spool file size in Kbytes"
+//config:	default 1024
+//config:	range 16 2097151
+//config:	depends on FEATURE_REMOTE_LOG_TCP
+//config:
 //config:config FEATURE_SYSLOGD_DUP
 //config:	bool "Support -D (drop dups) option"
 //config:	default y
@@ -72,6 +88,15 @@
 //config:	Includes milliseconds (HH:MM:SS.mmm) in timestamp when
 //config:	timestamps are added.
 //config:
+//config:config FEATURE_SYSLOGD_BATCH
+//config:	bool "Batch reading and writing of messages"
+//config:	default y
+//config:	depends on SYSLOGD
+//config:	help
+//config:	Receive up to 16 messages per system call (recvmmsg) and
+//config:	write all messages of such a batch to each log file at once.
+//config:	Adds -F SEC option to fsync log files periodically.
+//config:
 //config:config FEATURE_SYSLOGD_READ_BUFFER_SIZE
 //config:	int "Read buffer size in bytes"
 //config:	default 256
@@ -80,7 +105,7 @@
 //config:	help
 //config:	This option sets the size of the syslog read buffer.
 //config:	Actual memory usage increases around five times the
-//config:	change done here.
+//config:	change done here (twenty times with batching).
 //config:
 //config:config FEATURE_IPC_SYSLOG
 //config:	bool "Circular Buffer support"
@@ -99,11 +124,12 @@
 //config:config FEATURE_IPC_SYSLOG_BUFFER_SIZE
 //config:	int "Circular buffer size in Kbytes (minimum 4KB)"
 //config:	default 16
-//config:	range 4 2147483647
+//config:	range 4 1048576
 //config:	depends on FEATURE_IPC_SYSLOG
 //config:	help
 //config:	This option sets the size of the circular buffer
 //config:	used to record system log messages.
+//config:	It is rounded up to a power of 2.
 //config:
 //config:config FEATURE_KMSG_SYSLOG
 //config:	bool "Linux kernel printk buffer support"
@@ -133,6 +159,10 @@
 //usage:     "\n	-R HOST[:PORT]	Log to HOST:PORT (default PORT:514)"
 //usage:     "\n	-L		Log locally and via network (default is network only if -R)"
 //usage:	)
+//usage:	IF_FEATURE_REMOTE_LOG_TCP(
+//usage:     "\n	-R tcp://HOST[:PORT] Log to HOST:PORT via TCP, RFC 5424 format"
+//usage:     "\n	-Q DIR		Spool undelivered TCP messages in DIR"
+//usage:	)
 //usage:	IF_FEATURE_IPC_SYSLOG(
 /* NB: -Csize shouldn't have space (because size is optional) */
 //usage:     "\n	-C[size_kb]	Log to shared mem buffer (use logread to read it)"
@@ -145,6 +175,9 @@
 //usage:     "\n	-s SIZE		Max size (KB) before rotation (default 200KB, 0=off)"
 //usage:     "\n	-b N		N rotated logs to keep (default 1, max 99, 0=purge)"
 //usage:	)
+//usage:	IF_FEATURE_SYSLOGD_BATCH(
+//usage:     "\n	-F SEC		Fsync log files every SEC seconds (0: after each batch)"
+//usage:	)
 //usage:     "\n	-l N		Log only messages more urgent than prio N (1-8)"
 //usage:     "\n	-S		Smaller output"
 //usage:     "\n	-t		Strip client-generated timestamps"
@@ -174,14 +207,19 @@
 #include <sys/un.h>
 #include <sys/uio.h>
 
+#ifndef CONFIG_FEATURE_REMOTE_LOG_SPOOL_SIZE
+# define CONFIG_FEATURE_REMOTE_LOG_SPOOL_SIZE 0
+#endif
+
 #if ENABLE_FEATURE_REMOTE_LOG
 #include <netinet/in.h>
 #endif
 
 #if ENABLE_FEATURE_IPC_SYSLOG
 #include <sys/ipc.h>
-#include <sys/sem.h>
 #include <sys/shm.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 #endif
 
 
@@ -198,13 +236,32 @@
 enum {
 	MAX_READ = CONFIG_FEATURE_SYSLOGD_READ_BUFFER_SIZE,
 	DNS_WAIT_SEC = 2 * 60,
+	/* Messages per recvmmsg */
+	BATCH = ENABLE_FEATURE_SYSLOGD_BATCH ? 16 : 1,
+	/* Per-file output buffer, larger messages are written directly */
+	OUTBUF_SIZE = 8 * 1024,
+	/* TCP forwarding: send buffer, must hold the largest frame */
+	TCP_OUTBUF_SIZE = 64 * 1024,
+	TCP_RETRY_SEC = 5,
+	TCP_SPOOL_MAX = CONFIG_FEATURE_REMOTE_LOG_SPOOL_SIZE * 1024,
 };
 
-/* Semaphore operation structures */
+/* Shared memory buffer. One writer (us), any number of logread's.
+ * data[] is a ring of NUL-terminated messages, size is a power of 2.
+ * Positions are free-running byte counters, (pos & (size-1)) is the
+ * offset in data[]. Before overwriting anything we advance 'reserve',
+ * after the message is complete we advance 'commit' and FUTEX_WAKE
+ * followers sleeping on it. Readers take no locks: they copy out
+ * [cur, commit), then reread 'reserve' and throw away whatever is older
+ * than (reserve - size) since it may have been overwritten meanwhile.
+ * Thus readers never delay syslogd.
+ */
 struct shbuf_ds {
-	int32_t size;   /* size of data - 1 */
-	int32_t tail;   /* end of message list */
-	char data[1];   /* data/messages */
+	uint32_t magic;             /* SHBUF_MAGIC */
+	uint32_t size;              /* size of data[] */
+	volatile uint32_t reserve;  /* data up to here may be overwritten */
+	volatile uint32_t commit;   /* data up to here is valid */
+	char data[];                /* data/messages */
 };
 
 #if ENABLE_FEATURE_REMOTE_LOG
@@ -213,6 +270,18 @@ typedef struct {
 	unsigned last_dns_resolve;
 	len_and_sockaddr *remoteAddr;
 	const char *remoteHostname;
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+	smallint tcp;           /* -R tcp://HOST */
+	smallint connecting;    /* nonblocking connect() in progress */
+	unsigned last_connect;
+	unsigned dropped;       /* messages lost since last connect */
+	/* Octet-counted frames: outbuf[outpos..outlen) is not sent yet */
+	unsigned outlen, outpos;
+	char *outbuf;
+	/* Spool file: frames from spool_rd to spool_size are not in outbuf yet */
+	int spool_fd;
+	off_t spool_rd, spool_size;
+#endif
 } remoteHost_t;
 #endif
 
@@ -224,6 +293,13 @@ typedef struct logFile_t {
 	unsigned size;
 	uint8_t isRegular;
 #endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	uint8_t unsynced;
+	uint8_t dirty; /* on G.dirty_files list */
+	unsigned outlen;
+	char *outbuf;
+	struct logFile_t *next_dirty;
+#endif
 } logFile_t;
 
 #if ENABLE_FEATURE_SYSLOGD_CFG
@@ -249,14 +325,15 @@ IF_FEATURE_ROTATE_LOGFILE( \
 ) \
 IF_FEATURE_IPC_SYSLOG( \
 	int shmid; /* ipc shared memory id */   \
-	int s_semid; /* ipc semaphore id */     \
-	int shm_size;                           \
-	struct sembuf SMwup[1];                 \
-	struct sembuf SMwdn[3];                 \
+	unsigned shm_size;                      \
 ) \
 IF_FEATURE_SYSLOGD_CFG( \
 	logRule_t *log_rules; \
 ) \
+IF_FEATURE_SYSLOGD_BATCH( \
+	/* fsync interval in seconds, -1 = never */ \
+	int fsyncInterval; \
+) \
 IF_FEATURE_KMSG_SYSLOG( \
 	int kmsgfd; \
 	int primask; \
@@ -272,14 +349,41 @@ struct globals {
 #if ENABLE_FEATURE_REMOTE_LOG
 	llist_t *remoteHosts;
 #endif
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+	const char *spool_dir;
+	/* pollfd[0] is /dev/log, then TCP connections with pending output */
+	struct pollfd *pfd;
+	remoteHost_t **poll_rh;
+	/* RFC 3339 timestamp of last_rfc_sec */
+	time_t last_rfc_sec;
+	char rfc_date[sizeof("2026-10-19T12:53:10")];
+	char rfc_tz[sizeof("+hh:mm")];
+	char framebuf[16 + 256 + MAX_READ];
+#endif
 #if ENABLE_FEATURE_IPC_SYSLOG
 	struct shbuf_ds *shbuf;
 #endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	/* While processing a batch, log_locally() only buffers */
+	smallint batching;
+	IF_FEATURE_IPC_SYSLOG(smallint shm_wake_pending;)
+	smallint unsynced;
+	unsigned last_fsync;
+	logFile_t *dirty_files;
+	struct mmsghdr msgvec[BATCH];
+	struct iovec iov[BATCH];
+#endif
+	int recvlen[BATCH];
 	/* localhost's name. We print only first 64 chars */
 	char *hostname;
 
-	/* We recv into recvbuf... */
-	char recvbuf[MAX_READ * (1 + ENABLE_FEATURE_SYSLOGD_DUP)];
+	/* ctime() is not cheap, reuse it within one second */
+	time_t last_ctime;
+	char ctime_buf[sizeof("Jan 18 00:11:22.mmm")];
+
+	/* We recv into recvbuf (BATCH slots of MAX_READ bytes,
+	 * plus one to keep the last message for -D)... */
+	char recvbuf[MAX_READ * (BATCH + ENABLE_FEATURE_SYSLOGD_DUP)];
 	/* ...then copy to parsebuf, escaping control chars */
 	/* (can grow x2 max) */
 	char parsebuf[MAX_READ*2];
@@ -302,12 +406,12 @@ static const struct init_globals init_data = {
 	.logFileSize = 200 * 1024,
 	.logFileRotate = 1,
 #endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	.fsyncInterval = -1,
+#endif
 #if ENABLE_FEATURE_IPC_SYSLOG
 	.shmid = -1,
-	.s_semid = -1,
 	.shm_size = ((CONFIG_FEATURE_IPC_SYSLOG_BUFFER_SIZE)*1024), /* default shm size */
-	.SMwup = { {1, -1, IPC_NOWAIT} },
-	.SMwdn = { {0, 0}, {1, 0}, {1, +1} },
 #endif
 };
 
@@ -333,6 +437,8 @@ enum {
 	IF_FEATURE_SYSLOGD_DUP(   OPTBIT_dup        ,)	// -D
 	IF_FEATURE_SYSLOGD_CFG(   OPTBIT_cfg        ,)	// -f
 	IF_FEATURE_KMSG_SYSLOG(   OPTBIT_kmsg       ,)	// -K
+	IF_FEATURE_SYSLOGD_BATCH( OPTBIT_fsync      ,)	// -F
+	IF_FEATURE_REMOTE_LOG_TCP(OPTBIT_spool      ,)	// -Q
 
 	OPT_mark        = 1 << OPTBIT_mark    ,
 	OPT_nofork      = 1 << OPTBIT_nofork  ,
@@ -348,6 +454,8 @@ enum {
 	OPT_dup         = IF_FEATURE_SYSLOGD_DUP(   (1 << OPTBIT_dup        )) + 0,
 	OPT_cfg         = IF_FEATURE_SYSLOGD_CFG(   (1 << OPTBIT_cfg        )) + 0,
 	OPT_kmsg        = IF_FEATURE_KMSG_SYSLOG(   (1 << OPTBIT_kmsg       )) + 0,
+	OPT_fsync       = IF_FEATURE_SYSLOGD_BATCH( (1 << OPTBIT_fsync      )) + 0,
+	OPT_spool       = IF_FEATURE_REMOTE_LOG_TCP((1 << OPTBIT_spool      )) + 0,
 };
 #define OPTION_STR "m:nO:l:St" \
 	IF_FEATURE_ROTATE_LOGFILE("s:" ) \
@@ -357,18 +465,23 @@ enum {
 	IF_FEATURE_IPC_SYSLOG(    "C::") \
 	IF_FEATURE_SYSLOGD_DUP(   "D"  ) \
 	IF_FEATURE_SYSLOGD_CFG(   "f:" ) \
-	IF_FEATURE_KMSG_SYSLOG(   "K"  )
+	IF_FEATURE_KMSG_SYSLOG(   "K"  ) \
+	IF_FEATURE_SYSLOGD_BATCH( "F:" ) \
+	IF_FEATURE_REMOTE_LOG_TCP("Q:" )
 #define OPTION_DECL *opt_m, *opt_l \
 	IF_FEATURE_ROTATE_LOGFILE(,*opt_s) \
 	IF_FEATURE_ROTATE_LOGFILE(,*opt_b) \
 	IF_FEATURE_IPC_SYSLOG(    ,*opt_C = NULL) \
-	IF_FEATURE_SYSLOGD_CFG(   ,*opt_f = NULL)
+	IF_FEATURE_SYSLOGD_CFG(   ,*opt_f = NULL) \
+	IF_FEATURE_SYSLOGD_BATCH( ,*opt_F)
 #define OPTION_PARAM &opt_m, &(G.logFile.path), &opt_l \
 	IF_FEATURE_ROTATE_LOGFILE(,&opt_s) \
 	IF_FEATURE_ROTATE_LOGFILE(,&opt_b) \
 	IF_FEATURE_REMOTE_LOG(    ,&remoteAddrList) \
 	IF_FEATURE_IPC_SYSLOG(    ,&opt_C) \
-	IF_FEATURE_SYSLOGD_CFG(   ,&opt_f)
+	IF_FEATURE_SYSLOGD_CFG(   ,&opt_f) \
+	IF_FEATURE_SYSLOGD_BATCH( ,&opt_F) \
+	IF_FEATURE_REMOTE_LOG_TCP(,&G.spool_dir)
 
 
 #if ENABLE_FEATURE_SYSLOGD_CFG
@@ -556,8 +669,9 @@ static void parse_syslogdcfg(const char *file)
 #error Please check CONFIG_FEATURE_IPC_SYSLOG_BUFFER_SIZE
 #endif
 
-/* our shared key (syslogd.c and logread.c must be in sync) */
+/* our shared key and layout (syslogd.c and logread.c must be in sync) */
 enum { KEY_ID = 0x414e4547 }; /* "GENA" */
+enum { SHBUF_MAGIC = 0x4c4f4732 }; /* "LOG2" */
 
 static void ipcsyslog_cleanup(void)
 {
@@ -567,17 +681,21 @@ static void ipcsyslog_cleanup(void)
 	if (G.shmid != -1) {
 		shmctl(G.shmid, IPC_RMID, NULL);
 	}
-	if (G.s_semid != -1) {
-		semctl(G.s_semid, 0, IPC_RMID, 0);
-	}
 }
 
 static void ipcsyslog_init(void)
 {
+	unsigned seg_size;
+
+	/* Ring positions are masked, size must be a power of 2 */
+	while (G.shm_size & (G.shm_size - 1))
+		G.shm_size += G.shm_size & -G.shm_size;
+	seg_size = sizeof(struct shbuf_ds) + G.shm_size;
+
 	if (DEBUG)
-		printf("shmget(%x, %d,...)\n", (int)KEY_ID, G.shm_size);
+		printf("shmget(%x, %u,...)\n", (int)KEY_ID, seg_size);
 
-	G.shmid = shmget(KEY_ID, G.shm_size, IPC_CREAT | 0644);
+	G.shmid = shmget(KEY_ID, seg_size, IPC_CREAT | 0644);
 	if (G.shmid == -1) {
 		bb_simple_perror_msg_and_die("shmget");
 	}
@@ -587,61 +705,62 @@ static void ipcsyslog_init(void)
 		bb_simple_perror_msg_and_die("shmat");
 	}
 
-	memset(G.shbuf, 0, G.shm_size);
-	G.shbuf->size = G.shm_size - offsetof(struct shbuf_ds, data) - 1;
-	/*G.shbuf->tail = 0;*/
+	memset(G.shbuf, 0, seg_size);
+	G.shbuf->size = G.shm_size;
+	/*G.shbuf->reserve = G.shbuf->commit = 0;*/
+	/* Readers check this last */
+	__sync_synchronize();
+	G.shbuf->magic = SHBUF_MAGIC;
+}
 
-	/* we'll trust the OS to set initial semval to 0 (let's hope) */
-	G.s_semid = semget(KEY_ID, 2, IPC_CREAT | IPC_EXCL | 1023);
-	if (G.s_semid == -1) {
-		if (errno == EEXIST) {
-			G.s_semid = semget(KEY_ID, 2, 0);
-			if (G.s_semid != -1)
-				return;
-		}
-		bb_simple_perror_msg_and_die("semget");
-	}
+/* Wake up "logread -f". The mapping is read-only for readers,
+ * so they can't announce themselves: wake unconditionally,
+ * this is cheap when nobody waits */
+static void shmem_wake_readers(void)
+{
+	syscall(__NR_futex, &G.shbuf->commit, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
 }
 
 /* Write message to shared mem buffer */
 static void log_to_shmem(const char *msg)
 {
-	int old_tail, new_tail;
-	int len;
-
-	if (semop(G.s_semid, G.SMwdn, 3) == -1) {
-		bb_simple_perror_msg_and_die("SMwdn");
-	}
+	struct shbuf_ds *sb = G.shbuf;
+	uint32_t pos = sb->commit;
+	unsigned mask = sb->size - 1;
+	unsigned len, ofs, k;
 
-	/* Circular Buffer Algorithm:
-	 * --------------------------
-	 * tail == position where to store next syslog message.
-	 * tail's max value is (shbuf->size - 1)
-	 * Last byte of buffer is never used and remains NUL.
-	 */
 	len = strlen(msg) + 1; /* length with NUL included */
- again:
-	old_tail = G.shbuf->tail;
-	new_tail = old_tail + len;
-	if (new_tail < G.shbuf->size) {
-		/* store message, set new tail */
-		memcpy(G.shbuf->data + old_tail, msg, len);
-		G.shbuf->tail = new_tail;
-	} else {
-		/* k == available buffer space ahead of old tail */
-		int k = G.shbuf->size - old_tail;
-		/* copy what fits to the end of buffer, and repeat */
-		memcpy(G.shbuf->data + old_tail, msg, k);
-		msg += k;
-		len -= k;
-		G.shbuf->tail = 0;
-		goto again;
-	}
-	if (semop(G.s_semid, G.SMwup, 1) == -1) {
-		bb_simple_perror_msg_and_die("SMwup");
+	if (len > mask) {
+		/* -C4 and a huge CONFIG_FEATURE_SYSLOGD_READ_BUFFER_SIZE.
+		 * Keep the end, it is NUL-terminated */
+		msg += len - mask;
+		len = mask;
 	}
+
+	/* Tell readers what is about to be overwritten... */
+	sb->reserve = pos + len;
+	__sync_synchronize();
+	/* ...store message, possibly wrapping around... */
+	ofs = pos & mask;
+	k = sb->size - ofs;
+	if (k > len)
+		k = len;
+	memcpy(sb->data + ofs, msg, k);
+	memcpy(sb->data, msg + k, len - k);
+	__sync_synchronize();
+	/* ...and publish it */
+	sb->commit = pos + len;
+
 	if (DEBUG)
-		printf("tail:%d\n", G.shbuf->tail);
+		printf("commit:%u\n", (unsigned)sb->commit);
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	if (G.batching) {
+		/* flush_log_files() will do it once per batch */
+		G.shm_wake_pending = 1;
+		return;
+	}
+#endif
+	shmem_wake_readers();
 }
 #else
 static void ipcsyslog_cleanup(void) {}
@@ -687,13 +806,43 @@ static void kmsg_cleanup(void) {}
 static void log_to_kmsg(int pri UNUSED_PARAM, const char *msg UNUSED_PARAM) {}
 #endif /* FEATURE_KMSG_SYSLOG */
 
-/* Print a message to the log file. */
-static void log_locally(time_t now, char *msg, logFile_t *log_file)
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+static void fsync_one(logFile_t *log_file)
+{
+	if (log_file->unsynced) {
+		log_file->unsynced = 0;
+		if (log_file->fd > 1)
+			fsync(log_file->fd);
+	}
+}
+
+/* About to close the fd to reopen the file by name. If the name
+ * still leads to the same inode, the new fd will sync its data.
+ * If the file was rotated or deleted, sync it now or never */
+static void fsync_if_replaced(logFile_t *log_file)
+{
+	struct stat st_fd, st_path;
+
+	if (log_file->unsynced
+	 && (fstat(log_file->fd, &st_fd) != 0
+	    || stat(log_file->path, &st_path) != 0
+	    || st_fd.st_ino != st_path.st_ino
+	    || st_fd.st_dev != st_path.st_dev)
+	) {
+		fsync_one(log_file);
+	}
+}
+#else
+# define fsync_one(log_file) ((void)0)
+# define fsync_if_replaced(log_file) ((void)0)
+#endif
+
+/* Write data to the log file */
+static void write_locally(time_t now, const char *msg, int len, logFile_t *log_file)
 {
 #ifdef SYSLOGD_WRLOCK
 	struct flock fl;
 #endif
-	int len = strlen(msg);
 
 	/* fd can't be 0 (we connect fd 0 to /dev/log socket) */
 	/* fd is 1 if "-O -" is in use */
@@ -708,6 +857,7 @@ static void log_locally(time_t now, char *msg, logFile_t *log_file)
 			now = time(NULL);
 		if (log_file->last_log_time != now) {
 			log_file->last_log_time = now;
+			fsync_if_replaced(log_file);
 			close(log_file->fd);
 			goto reopen;
 		}
@@ -786,6 +936,8 @@ static void log_locally(time_t now, char *msg, logFile_t *log_file)
 		fl.l_type = F_UNLCK;
 		fcntl(log_file->fd, F_SETLKW, &fl);
 #endif
+		/* It was renamed to .0 or deleted */
+		fsync_one(log_file);
 		close(log_file->fd);
 		goto reopen;
 	}
@@ -796,6 +948,10 @@ static void log_locally(time_t now, char *msg, logFile_t *log_file)
 #else
 	full_write(log_file->fd, msg, len);
 #endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	if (G.fsyncInterval >= 0)
+		G.unsynced = log_file->unsynced = 1;
+#endif
 
 #ifdef SYSLOGD_WRLOCK
 	fl.l_type = F_UNLCK;
@@ -803,6 +959,81 @@ static void log_locally(time_t now, char *msg, logFile_t *log_file)
 #endif
 }
 
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+static void flush_log_file(logFile_t *log_file)
+{
+	write_locally(0, log_file->outbuf, log_file->outlen, log_file);
+	log_file->outlen = 0;
+}
+
+static void fsync_log_files(void)
+{
+# if ENABLE_FEATURE_SYSLOGD_CFG
+	logRule_t *rule;
+	for (rule = G.log_rules; rule; rule = rule->next)
+		fsync_one(rule->file);
+# endif
+	fsync_one(&G.logFile);
+	G.unsynced = 0;
+	G.last_fsync = monotonic_sec();
+}
+
+/* End of batch: write out everything buffered by log_locally() */
+static void flush_log_files(void)
+{
+	logFile_t *log_file;
+
+	G.batching = 0;
+	for (log_file = G.dirty_files; log_file; log_file = log_file->next_dirty) {
+		log_file->dirty = 0;
+		if (log_file->outlen)
+			flush_log_file(log_file);
+	}
+	G.dirty_files = NULL;
+# if ENABLE_FEATURE_IPC_SYSLOG
+	if (G.shm_wake_pending) {
+		G.shm_wake_pending = 0;
+		shmem_wake_readers();
+	}
+# endif
+	if (G.unsynced && monotonic_sec() - G.last_fsync >= (unsigned)G.fsyncInterval)
+		fsync_log_files();
+}
+
+/* Print a message to the log file (buffered while in a batch) */
+static void log_locally(time_t now, char *msg, logFile_t *log_file)
+{
+	unsigned len = strlen(msg);
+
+	if (!G.batching) {
+		write_locally(now, msg, len, log_file);
+		return;
+	}
+	if (log_file->outlen + len > OUTBUF_SIZE) {
+		if (log_file->outlen)
+			flush_log_file(log_file);
+		if (len > OUTBUF_SIZE) {
+			write_locally(now, msg, len, log_file);
+			return;
+		}
+	}
+	if (!log_file->outbuf)
+		log_file->outbuf = xmalloc(OUTBUF_SIZE);
+	if (!log_file->dirty) {
+		log_file->dirty = 1;
+		log_file->next_dirty = G.dirty_files;
+		G.dirty_files = log_file;
+	}
+	memcpy(log_file->outbuf + log_file->outlen, msg, len);
+	log_file->outlen += len;
+}
+#else
+static void log_locally(time_t now, char *msg, logFile_t *log_file)
+{
+	write_locally(now, msg, strlen(msg), log_file);
+}
+#endif
+
 static void parse_fac_prio_20(int pri, char *res20)
 {
 	const CODE *c_pri, *c_fac;
@@ -818,6 +1049,16 @@ static void parse_fac_prio_20(int pri, char *res20)
 	snprintf(res20, 20, "<%d>", pri);
 }
 
+/* "Jan 18 00:11:22", not NUL terminated */
+static char *ctime15(time_t now)
+{
+	if (now != G.last_ctime || !G.ctime_buf[0]) {
+		G.last_ctime = now;
+		memcpy(G.ctime_buf, ctime(&now) + 4, 15); /* skip day of week */
+	}
+	return G.ctime_buf;
+}
+
 /* len parameter is used only for "is there a timestamp?" check.
  * NB: some callers cheat and supply len==0 when they know
  * that there is no timestamp, short-circuiting the test. */
@@ -844,7 +1085,7 @@ static void timestamp_and_log(int pri, char *msg, int len)
 		struct timeval tv;
 		xgettimeofday(&tv);
 		now = tv.tv_sec;
-		timestamp = ctime(&now) + 4; /* skip day of week */
+		timestamp = ctime15(now);
 		/* overwrite year by milliseconds, zero terminate */
 		sprintf(timestamp + 15, ".%03u", (unsigned)tv.tv_usec / 1000u);
 	} else {
@@ -853,7 +1094,7 @@ static void timestamp_and_log(int pri, char *msg, int len)
 #else
 	if (!timestamp) {
 		time(&now);
-		timestamp = ctime(&now) + 4; /* skip day of week */
+		timestamp = ctime15(now);
 	}
 	timestamp[15] = '\0';
 #endif
@@ -983,7 +1224,7 @@ static int create_socket(void)
 }
 
 #if ENABLE_FEATURE_REMOTE_LOG
-static int try_to_resolve_remote(remoteHost_t *rh)
+static int try_to_resolve_remote(remoteHost_t *rh, int type)
 {
 	if (!rh->remoteAddr) {
 		unsigned now = monotonic_sec();
@@ -996,7 +1237,378 @@ static int try_to_resolve_remote(remoteHost_t *rh)
 		if (!rh->remoteAddr)
 			return -1;
 	}
-	return xsocket(rh->remoteAddr->u.sa.sa_family, SOCK_DGRAM, 0);
+	return xsocket(rh->remoteAddr->u.sa.sa_family, type, 0);
+}
+#endif
+
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+/* Return the end of the last complete "LEN SP MSG" frame in buf[0..len) */
+static unsigned frames_end(const char *buf, unsigned len)
+{
+	unsigned pos = 0;
+
+	for (;;) {
+		unsigned p = pos;
+		unsigned flen = 0;
+
+		while (p < len && isdigit(buf[p]))
+			flen = flen * 10 + (buf[p++] - '0');
+		if (p >= len || p == pos || buf[p] != ' ' || flen > len - p - 1)
+			return pos;
+		pos = p + 1 + flen;
+	}
+}
+
+static void tcp_close(remoteHost_t *rh)
+{
+	close(rh->remoteFD);
+	rh->remoteFD = -1;
+	rh->connecting = 0;
+	/* The frame we were in the middle of will be resent in full */
+	rh->outpos = frames_end(rh->outbuf, rh->outpos);
+}
+
+static void tcp_connected(remoteHost_t *rh)
+{
+	rh->connecting = 0;
+	if (rh->dropped) {
+		char msg[sizeof("forwarding to %s: %u messages lost") + 64 + sizeof(int)*3];
+		sprintf(msg, "forwarding to %.64s: %u messages lost",
+				rh->remoteHostname, rh->dropped);
+		rh->dropped = 0;
+		timestamp_and_log_internal(msg);
+	}
+}
+
+static void tcp_connect_failed(remoteHost_t *rh)
+{
+	tcp_close(rh);
+	/* Address may be stale, resolve it again next time */
+	free(rh->remoteAddr);
+	rh->remoteAddr = NULL;
+}
+
+static void tcp_connect(remoteHost_t *rh)
+{
+	unsigned now = monotonic_sec();
+
+	if (now - rh->last_connect < TCP_RETRY_SEC)
+		return;
+	rh->last_connect = now;
+	rh->remoteFD = try_to_resolve_remote(rh, SOCK_STREAM);
+	if (rh->remoteFD == -1)
+		return;
+	ndelay_on(rh->remoteFD);
+	close_on_exec_on(rh->remoteFD);
+	if (connect(rh->remoteFD, &rh->remoteAddr->u.sa, rh->remoteAddr->len) == 0) {
+		tcp_connected(rh);
+		return;
+	}
+	if (errno == EINPROGRESS) {
+		rh->connecting = 1;
+		return;
+	}
+	tcp_connect_failed(rh);
+}
+
+/* Frames which don't fit into outbuf go to the spool file */
+static void tcp_spool(remoteHost_t *rh, const char *frame, unsigned len)
+{
+	if (rh->spool_fd < 0 || rh->spool_size + len > TCP_SPOOL_MAX
+	 || pwrite(rh->spool_fd, frame, len, rh->spool_size) != (ssize_t)len
+	) {
+		rh->dropped++;
+		return;
+	}
+	rh->spool_size += len;
+}
+
+static void tcp_queue(remoteHost_t *rh, const char *frame, unsigned len)
+{
+	/* Not connected: straight to disk if we can.
+	 * Keep order: once we spool, everything goes there until it drains */
+	if ((rh->remoteFD == -1 && rh->spool_fd >= 0)
+	 || rh->spool_rd != rh->spool_size || rh->outlen + len > TCP_OUTBUF_SIZE
+	) {
+		/* Reclaim sent space first. Only whole frames: outpos may be
+		 * in the middle of one, and outbuf must start on a frame
+		 * for tcp_close() and tcp_save_all() */
+		if (rh->outpos != 0 && rh->spool_rd == rh->spool_size) {
+			unsigned sent = frames_end(rh->outbuf, rh->outpos);
+			rh->outlen -= sent;
+			rh->outpos -= sent;
+			memmove(rh->outbuf, rh->outbuf + sent, rh->outlen);
+		}
+		if (rh->spool_fd >= 0 || rh->outlen + len > TCP_OUTBUF_SIZE) {
+			tcp_spool(rh, frame, len);
+			return;
+		}
+	}
+	memcpy(rh->outbuf + rh->outlen, frame, len);
+	rh->outlen += len;
+}
+
+/* Send what we can without blocking */
+static void tcp_pump(remoteHost_t *rh)
+{
+	if (rh->remoteFD == -1)
+		tcp_connect(rh);
+	if (rh->remoteFD == -1 || rh->connecting)
+		return;
+
+	for (;;) {
+		ssize_t n;
+
+		if (rh->outpos == rh->outlen) {
+			rh->outpos = rh->outlen = 0;
+			if (rh->spool_rd == rh->spool_size) {
+				if (rh->spool_size != 0) {
+					/* Spool is fully delivered */
+					ftruncate(rh->spool_fd, 0);
+					rh->spool_rd = rh->spool_size = 0;
+				}
+				return;
+			}
+			/* Replay spooled frames */
+			n = pread(rh->spool_fd, rh->outbuf,
+				MIN((off_t)TCP_OUTBUF_SIZE, rh->spool_size - rh->spool_rd),
+				rh->spool_rd);
+			rh->outlen = n > 0 ? frames_end(rh->outbuf, n) : 0;
+			if (rh->outlen == 0) {
+				/* I/O error or garbage, discard the spool */
+				bb_simple_error_msg("bad spool file, discarding");
+				ftruncate(rh->spool_fd, 0);
+				rh->spool_rd = rh->spool_size = 0;
+				return;
+			}
+			rh->spool_rd += rh->outlen;
+		}
+		n = send(rh->remoteFD, rh->outbuf + rh->outpos, rh->outlen - rh->outpos,
+				MSG_DONTWAIT | MSG_NOSIGNAL);
+		if (n < 0) {
+			if (errno != EAGAIN && errno != EINTR)
+				tcp_close(rh);
+			return;
+		}
+		rh->outpos += n;
+	}
+}
+
+static int tcp_pending(remoteHost_t *rh)
+{
+	return rh->outpos != rh->outlen || rh->spool_rd != rh->spool_size;
+}
+
+static void tcp_pump_all(void)
+{
+	llist_t *item;
+
+	for (item = G.remoteHosts; item; item = item->link) {
+		remoteHost_t *rh = (remoteHost_t *)item->data;
+		if (rh->tcp && tcp_pending(rh))
+			tcp_pump(rh);
+	}
+}
+
+/* Fill G.pfd[1..] with connections waiting to become writable,
+ * lower *timeout_ms to the next reconnect attempt. Return nfds */
+static int tcp_poll_setup(int *timeout_ms)
+{
+	llist_t *item;
+	int nfds = 1;
+
+	for (item = G.remoteHosts; item; item = item->link) {
+		remoteHost_t *rh = (remoteHost_t *)item->data;
+
+		if (!rh->tcp || !tcp_pending(rh))
+			continue;
+		if (rh->remoteFD == -1) {
+			unsigned elapsed = monotonic_sec() - rh->last_connect;
+			int ms = elapsed >= TCP_RETRY_SEC ? 0 : (TCP_RETRY_SEC - elapsed) * 1000;
+			if (*timeout_ms < 0 || ms < *timeout_ms)
+				*timeout_ms = ms;
+			continue;
+		}
+		G.pfd[nfds].fd = rh->remoteFD;
+		G.pfd[nfds].events = POLLOUT;
+		G.poll_rh[nfds] = rh;
+		nfds++;
+	}
+	return nfds;
+}
+
+static void tcp_poll_done(int nfds)
+{
+	int i;
+
+	for (i = 1; i < nfds; i++) {
+		remoteHost_t *rh = G.poll_rh[i];
+
+		if (!G.pfd[i].revents)
+			continue;
+		if (rh->connecting) {
+			int err = 0;
+			socklen_t len = sizeof(err);
+			getsockopt(rh->remoteFD, SOL_SOCKET, SO_ERROR, &err, &len);
+			if (err) {
+				tcp_connect_failed(rh);
+				continue;
+			}
+			tcp_connected(rh);
+		}
+		tcp_pump(rh);
+	}
+}
+
+/* "2026-10-19T12:53:10.123456+02:00" */
+static char *rfc3339_timestamp(char *buf)
+{
+	struct timeval tv;
+
+	xgettimeofday(&tv);
+	if (tv.tv_sec != G.last_rfc_sec || !G.rfc_date[0]) {
+		struct tm tm;
+		char *z = G.rfc_tz;
+
+		G.last_rfc_sec = tv.tv_sec;
+		localtime_r(&tv.tv_sec, &tm);
+		strftime(G.rfc_date, sizeof(G.rfc_date), "%Y-%m-%dT%H:%M:%S", &tm);
+		/* "+hhmm" -> "+hh:mm" */
+		strftime(z, sizeof(G.rfc_tz), "%z", &tm);
+		z[5] = z[4];
+		z[4] = z[3];
+		z[3] = ':';
+		z[6] = '\0';
+	}
+	sprintf(buf, "%s.%06u%s", G.rfc_date, (unsigned)tv.tv_usec, G.rfc_tz);
+	return buf;
+}
+
+/* Convert one received message (without the trailing NUL) to RFC 5424,
+ * frame it and queue for sending */
+static void tcp_forward_one(remoteHost_t *rh, char *p, char *end)
+{
+	char ts[sizeof("2026-10-19T12:53:10.123456+hh:mm")];
+	char cnt[sizeof(int)*3 + 2];
+	char *body;
+	const char *app = "-";
+	const char *procid = "-";
+	int app_len = 1, procid_len = 1;
+	int pri = (LOG_USER | LOG_NOTICE);
+	unsigned len;
+	int i;
+	char *q;
+
+	if (*p == '<') {
+		pri = bb_strtou(p + 1, &p, 10);
+		if (*p == '>')
+			p++;
+		if (pri & ~(LOG_FACMASK | LOG_PRIMASK))
+			pri = (LOG_USER | LOG_NOTICE);
+	}
+	/* Drop RFC 3164 "Jan 18 00:11:22 " timestamp, we send our own */
+	if (end - p >= 16 && p[3] == ' ' && p[6] == ' '
+	 && p[9] == ':' && p[12] == ':' && p[15] == ' '
+	) {
+		p += 16;
+	}
+	/* "TAG[PID]: msg" or "TAG: msg" */
+	for (q = p; q < end && q - p < 48; q++) {
+		if (*q == ':' || *q == '[' || *q == ' ')
+			break;
+	}
+	if (q != p && q < end && (*q == ':' || *q == '[')) {
+		char *pid = NULL, *pid_end = NULL;
+
+		if (*q == '[') {
+			pid = q + 1;
+			pid_end = memchr(pid, ']', end - pid);
+			if (!pid_end || pid_end == pid || pid_end - pid > 128)
+				goto no_tag;
+			if (pid_end + 1 == end || pid_end[1] != ':')
+				goto no_tag;
+		}
+		app = p;
+		app_len = q - p;
+		if (pid) {
+			procid = pid;
+			procid_len = pid_end - pid;
+			q = pid_end + 1;
+		}
+		p = q + 1; /* skip ':' */
+		if (p < end && *p == ' ')
+			p++;
+	}
+ no_tag:
+	body = G.framebuf + 16;
+	len = sprintf(body, "<%d>1 %s %.64s %.*s %.*s - - ",
+			pri, rfc3339_timestamp(ts), G.hostname,
+			app_len, app, procid_len, procid);
+	memcpy(body + len, p, end - p);
+	len += end - p;
+	/* Prepend octet count */
+	i = sprintf(cnt, "%u ", len);
+	memcpy(body - i, cnt, i);
+	tcp_queue(rh, body - i, len + i);
+}
+
+/* buf[sz] is not part of the message. There can be embedded NULs,
+ * as in split_escape_and_log() each part is a separate message */
+static void tcp_forward(remoteHost_t *rh, char *buf, int sz)
+{
+	char *end = buf + sz;
+
+	while (buf < end) {
+		char *e = memchr(buf, '\0', end - buf);
+		if (!e)
+			e = end;
+		if (e != buf)
+			tcp_forward_one(rh, buf, e);
+		buf = e + 1;
+	}
+}
+
+/* Exiting: put unsent part of outbuf back in front of the spool */
+static void tcp_save_all(void)
+{
+	llist_t *item;
+
+	for (item = G.remoteHosts; item; item = item->link) {
+		remoteHost_t *rh = (remoteHost_t *)item->data;
+		unsigned start, len;
+		off_t tail;
+		char *buf;
+
+		if (!rh->tcp || rh->spool_fd < 0 || !tcp_pending(rh))
+			continue;
+		start = frames_end(rh->outbuf, rh->outpos);
+		len = rh->outlen - start;
+		tail = rh->spool_size - rh->spool_rd;
+		if (len + tail > TCP_SPOOL_MAX)
+			len = 0; /* should not happen */
+		buf = xmalloc(len + tail);
+		memcpy(buf, rh->outbuf + start, len);
+		if (pread(rh->spool_fd, buf + len, tail, rh->spool_rd) == tail) {
+			pwrite(rh->spool_fd, buf, len + tail, 0);
+			ftruncate(rh->spool_fd, len + tail);
+		}
+		free(buf);
+	}
+}
+
+static void tcp_init(remoteHost_t *rh)
+{
+	rh->tcp = 1;
+	rh->remoteHostname += sizeof("tcp://") - 1;
+	rh->outbuf = xmalloc(TCP_OUTBUF_SIZE);
+	rh->spool_fd = -1;
+	if (G.spool_dir) {
+		char *path = concat_path_file(G.spool_dir, rh->remoteHostname);
+		rh->spool_fd = xopen(path, O_RDWR | O_CREAT | O_CLOEXEC);
+		free(path);
+		/* Spooled by previous incarnation? Will be sent first */
+		rh->spool_size = xlseek(rh->spool_fd, 0, SEEK_END);
+	}
 }
 #endif
 
@@ -1011,6 +1623,9 @@ static int NOINLINE syslogd_init(char **argv)
 #if ENABLE_FEATURE_REMOTE_LOG
 	llist_t *remoteAddrList = NULL;
 #endif
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+	unsigned n = 0;
+#endif
 
 	/* No non-option params */
 	opts = getopt32(argv, "^"OPTION_STR"\0""=0", OPTION_PARAM);
@@ -1020,9 +1635,18 @@ static int NOINLINE syslogd_init(char **argv)
 		rh->remoteHostname = llist_pop(&remoteAddrList);
 		rh->remoteFD = -1;
 		rh->last_dns_resolve = monotonic_sec() - DNS_WAIT_SEC - 1;
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+		if (is_prefixed_with(rh->remoteHostname, "tcp://"))
+			tcp_init(rh);
+		n++;
+#endif
 		llist_add_to(&G.remoteHosts, rh);
 	}
 #endif
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+	G.pfd = xzalloc((n + 1) * sizeof(G.pfd[0]));
+	G.poll_rh = xzalloc((n + 1) * sizeof(G.poll_rh[0]));
+#endif
 
 #ifdef SYSLOGD_MARK
 	if (opts & OPT_mark) // -m
@@ -1041,7 +1665,11 @@ static int NOINLINE syslogd_init(char **argv)
 #endif
 #if ENABLE_FEATURE_IPC_SYSLOG
 	if (opt_C) // -Cn
-		G.shm_size = xatoul_range(opt_C, 4, INT_MAX/1024) * 1024;
+		G.shm_size = xatoul_range(opt_C, 4, 1024*1024) * 1024;
+#endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	if (opts & OPT_fsync) // -F
+		G.fsyncInterval = xatou_range(opt_F, 0, INT_MAX);
 #endif
 	/* If they have not specified remote logging, then log locally */
 	if (ENABLE_FEATURE_REMOTE_LOG && !(opts & OPT_remotelog)) // -R
@@ -1080,6 +1708,63 @@ static int NOINLINE syslogd_init(char **argv)
 	return opts;
 }
 
+/* Receive up to BATCH messages into recvbuf slots, return their number */
+static int recv_batch(void)
+{
+	int n;
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	int i;
+
+	/* Don't sleep past the moment when fsync is due,
+	 * keep TCP forwarding going while waiting */
+	for (;;) {
+		struct pollfd pfd1, *pfd = &pfd1;
+		int timeout = -1;
+		int nfds = 1;
+
+		if (G.unsynced) {
+			unsigned elapsed = monotonic_sec() - G.last_fsync;
+			if (elapsed >= (unsigned)G.fsyncInterval)
+				fsync_log_files();
+			else
+				timeout = (G.fsyncInterval - elapsed) * 1000;
+		}
+# if ENABLE_FEATURE_REMOTE_LOG_TCP
+		pfd = G.pfd;
+		nfds = tcp_poll_setup(&timeout);
+# endif
+		if (nfds == 1 && timeout < 0)
+			break;
+		pfd[0].fd = STDIN_FILENO;
+		pfd[0].events = POLLIN;
+		n = poll(pfd, nfds, timeout);
+		if (n < 0)
+			return n;
+# if ENABLE_FEATURE_REMOTE_LOG_TCP
+		tcp_poll_done(nfds);
+		if (n == 0) /* time to reconnect? */
+			tcp_pump_all();
+# endif
+		if (pfd[0].revents)
+			break;
+	}
+
+	/* Block for the first message, then take whatever is queued */
+	n = recvmmsg(STDIN_FILENO, G.msgvec, BATCH, MSG_WAITFORONE, NULL);
+	if (n >= 0) {
+		for (i = 0; i < n; i++)
+			G.recvlen[i] = G.msgvec[i].msg_len;
+		return n;
+	}
+	if (errno != ENOSYS)
+		return n;
+	/* Linux < 2.6.33 */
+#endif
+	n = read(STDIN_FILENO, G.recvbuf, MAX_READ - 1);
+	G.recvlen[0] = n;
+	return n < 0 ? n : 1;
+}
+
 int syslogd_main(int argc, char **argv) MAIN_EXTERNALLY_VISIBLE;
 int syslogd_main(int argc UNUSED_PARAM, char **argv)
 {
@@ -1089,43 +1774,47 @@ int syslogd_main(int argc UNUSED_PARAM, char **argv)
 #endif
 #if ENABLE_FEATURE_SYSLOGD_DUP
 	int last_sz = -1;
-	char *last_buf;
-	char *recvbuf;
-#else
-#define recvbuf (G.recvbuf)
+	char *last_buf = NULL;
+	char *dup_buf;
 #endif
 
 	INIT_G();
 	opts = syslogd_init(argv);
+#if ENABLE_FEATURE_SYSLOGD_DUP
+	dup_buf = G.recvbuf + BATCH * MAX_READ;
+#endif
 
 	timestamp_and_log_internal("syslogd started: BusyBox v" BB_VER);
 	write_pidfile_std_path_and_ext("syslogd");
 
-#if ENABLE_FEATURE_SYSLOGD_DUP
-	recvbuf = G.recvbuf;
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	{
+		int i;
+		for (i = 0; i < BATCH; i++) {
+			G.iov[i].iov_base = G.recvbuf + i * MAX_READ;
+			G.iov[i].iov_len = MAX_READ - 1;
+			G.msgvec[i].msg_hdr.msg_iov = &G.iov[i];
+			G.msgvec[i].msg_hdr.msg_iovlen = 1;
+		}
+	}
 #endif
 	while (!bb_got_signal) {
-		ssize_t sz;
+		int n, i;
 
-#if ENABLE_FEATURE_SYSLOGD_DUP
-		last_buf = recvbuf;
-		if (recvbuf == G.recvbuf)
-			recvbuf = G.recvbuf + MAX_READ;
-		else
-			recvbuf = G.recvbuf;
-#endif
- read_again:
-		sz = read(STDIN_FILENO, recvbuf, MAX_READ - 1);
-		if (sz < 0) {
+		n = recv_batch();
+		if (n < 0) {
 			if (!bb_got_signal)
 				bb_perror_msg("read from %s", _PATH_LOG);
 			break;
 		}
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+		G.batching = 1;
+#endif
+		for (i = 0; i < n; i++) {
+			char *recvbuf = G.recvbuf + i * MAX_READ;
+			ssize_t sz = G.recvlen[i];
 
-		/* Drop trailing '\n' and NULs (typically there is one NUL) */
-		while (1) {
-			if (sz == 0)
-				goto read_again;
+			/* Drop trailing '\n' and NULs (typically there is one NUL) */
 			/* man 3 syslog says: "A trailing newline is added when needed".
 			 * However, neither glibc nor uclibc do this:
 			 * syslog(prio, "test")   sends "test\0" to /dev/log,
@@ -1133,65 +1822,93 @@ int syslogd_main(int argc UNUSED_PARAM, char **argv)
 			 * IOW: newline is passed verbatim!
 			 * I take it to mean that it's syslogd's job
 			 * to make those look identical in the log files. */
-			if (recvbuf[sz-1] != '\0' && recvbuf[sz-1] != '\n')
-				break;
-			sz--;
-		}
-#if ENABLE_FEATURE_SYSLOGD_DUP
-		if ((opts & OPT_dup) && (sz == last_sz))
-			if (memcmp(last_buf, recvbuf, sz) == 0)
+			while (sz != 0 && (recvbuf[sz-1] == '\0' || recvbuf[sz-1] == '\n'))
+				sz--;
+			if (sz == 0)
 				continue;
-		last_sz = sz;
+#if ENABLE_FEATURE_SYSLOGD_DUP
+			if ((opts & OPT_dup) && (sz == last_sz))
+				if (memcmp(last_buf, recvbuf, sz) == 0)
+					continue;
+			last_sz = sz;
+			last_buf = recvbuf;
 #endif
 #if ENABLE_FEATURE_REMOTE_LOG
-		/* Stock syslogd sends it '\n'-terminated
-		 * over network, mimic that */
-		recvbuf[sz] = '\n';
-
-		/* We are not modifying log messages in any way before send */
-		/* Remote site cannot trust _us_ anyway and need to do validation again */
-		for (item = G.remoteHosts; item != NULL; item = item->link) {
-			remoteHost_t *rh = (remoteHost_t *)item->data;
-
-			if (rh->remoteFD == -1) {
-				rh->remoteFD = try_to_resolve_remote(rh);
-				if (rh->remoteFD == -1)
+			/* Stock syslogd sends it '\n'-terminated
+			 * over network, mimic that */
+			recvbuf[sz] = '\n';
+
+			/* We are not modifying log messages in any way before send */
+			/* Remote site cannot trust _us_ anyway and need to do validation again */
+			for (item = G.remoteHosts; item != NULL; item = item->link) {
+				remoteHost_t *rh = (remoteHost_t *)item->data;
+
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+				if (rh->tcp) {
+					/* Sent after the batch */
+					tcp_forward(rh, recvbuf, sz);
 					continue;
-			}
+				}
+#endif
+				if (rh->remoteFD == -1) {
+					rh->remoteFD = try_to_resolve_remote(rh, SOCK_DGRAM);
+					if (rh->remoteFD == -1)
+						continue;
+				}
 
-			/* Send message to remote logger.
-			 * On some errors, close and set remoteFD to -1
-			 * so that DNS resolution is retried.
-			 */
-			if (sendto(rh->remoteFD, recvbuf, sz+1,
-					MSG_DONTWAIT | MSG_NOSIGNAL,
-					&(rh->remoteAddr->u.sa), rh->remoteAddr->len) == -1
-			) {
-				switch (errno) {
-				case ECONNRESET:
-				case ENOTCONN: /* paranoia */
-				case EPIPE:
-					close(rh->remoteFD);
-					rh->remoteFD = -1;
-					free(rh->remoteAddr);
-					rh->remoteAddr = NULL;
+				/* Send message to remote logger.
+				 * On some errors, close and set remoteFD to -1
+				 * so that DNS resolution is retried.
+				 */
+				if (sendto(rh->remoteFD, recvbuf, sz+1,
+						MSG_DONTWAIT | MSG_NOSIGNAL,
+						&(rh->remoteAddr->u.sa), rh->remoteAddr->len) == -1
+				) {
+					switch (errno) {
+					case ECONNRESET:
+					case ENOTCONN: /* paranoia */
+					case EPIPE:
+						close(rh->remoteFD);
+						rh->remoteFD = -1;
+						free(rh->remoteAddr);
+						rh->remoteAddr = NULL;
+					}
 				}
 			}
-		}
 #endif
-		if (!ENABLE_FEATURE_REMOTE_LOG || (opts & OPT_locallog)) {
-			recvbuf[sz] = '\0'; /* ensure it *is* NUL terminated */
-			split_escape_and_log(recvbuf, sz);
+			if (!ENABLE_FEATURE_REMOTE_LOG || (option_mask32 & OPT_locallog)) {
+				recvbuf[sz] = '\0'; /* ensure it *is* NUL terminated */
+				split_escape_and_log(recvbuf, sz);
+			}
+		} /* for each message in batch */
+#if ENABLE_FEATURE_SYSLOGD_DUP
+		/* Next batch will overwrite the slots */
+		if (last_buf && last_buf != dup_buf) {
+			memcpy(dup_buf, last_buf, last_sz);
+			last_buf = dup_buf;
 		}
+#endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+		flush_log_files();
+#endif
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+		tcp_pump_all();
+#endif
 	} /* while (!bb_got_signal) */
 
 	timestamp_and_log_internal("syslogd exiting");
+#if ENABLE_FEATURE_REMOTE_LOG_TCP
+	tcp_save_all();
+#endif
+#if ENABLE_FEATURE_SYSLOGD_BATCH
+	if (G.unsynced)
+		fsync_log_files();
+#endif
 	remove_pidfile_std_path_and_ext("syslogd");
 	ipcsyslog_cleanup();
 	if (opts & OPT_kmsg)
 		kmsg_cleanup();
 	kill_myself_with_sig(bb_got_signal);
-#undef recvbuf
 }
 
 /* Clean up. Needed because we are included from syslogd_and_logger.c */
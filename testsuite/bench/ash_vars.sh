@@ -0,0 +1,27 @@
+#!/bin/sh
+# Microbenchmark for shell variable and command lookup.
+#
+# Usage: ash_vars.sh [SHELL [NVARS [LOOPS]]]
+# SHELL defaults to "../../busybox ash" relative to this script.
+#
+# Each case runs in a fresh shell which first creates NVARS exported
+# variables (as a large sourced build environment would). The output
+# of the cases themselves is checked for sanity only.
+
+. "${0%/*}/lib.sh"
+sh=${1:-"$dir/../../busybox ash"}
+nvars=${2:-20000}
+loops=${3:-100000}
+
+run()
+{
+	$sh -c "i=0; while [ \$i -lt $nvars ]; do export V_\$i=value_\$i; i=\$((i+1)); done; $1"
+}
+
+time_one setup        run "echo \$V_$((nvars - 1))"
+time_one read         run "i=0; s=0; while [ \$i -lt $loops ]; do s=\$((s + \${#V_1})); i=\$((i+1)); done; echo \$s"
+time_one write        run "i=0; while [ \$i -lt $loops ]; do X=\$i; Y=\$X; i=\$((i+1)); done; echo \$Y"
+time_one arith        run "i=0; while [ \$i -lt $loops ]; do : \$((a = i * 2, b = a + i)); i=\$((i+1)); done; echo \$b"
+time_one create_unset run "i=0; while [ \$i -lt $loops ]; do eval N_\$((i % 1000))=\$i; unset N_\$(((i + 500) % 1000)); i=\$((i+1)); done; echo \$N_999"
+time_one missing      run "i=0; while [ \$i -lt $loops ]; do : \${NOT_SET_VAR:-x}; i=\$((i+1)); done; echo ok"
+time_one commands     run "f() { :; }; i=0; while [ \$i -lt $loops ]; do f; true; i=\$((i+1)); done; echo ok"
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Microbenchmark for bc arbitrary precision arithmetic.
+#
+# Usage: bc_big.sh [BC]
+# BC defaults to "../../busybox bc" relative to this script.
+#
+# Each case is run in a fresh bc. The last few digits of the result
+# are printed, so that a wrong answer is easy to spot.
+
+. "${0%/*}/lib.sh"
+bc=${1:-"$dir/../../busybox bc"}
+
+run()
+{
+	out=$(echo "$1" | $bc -l | tr -d '\\\n') || return
+	echo "...${out#"${out%??????????}"}"
+}
+
+time_one pow  run "a=3^100000; a%1000000007"
+time_one mul  run "a=3^100000; b=7^80000; c=a*b; c%1000000007"
+time_one div  run "scale=5000; x=3^3000; y=7^2000; x/y"
+time_one sqrt run "scale=4000; sqrt(2)"
+time_one pi   run "scale=600; 4*a(1)"
+time_one exp  run "scale=500; e(100)"
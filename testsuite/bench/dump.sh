@@ -0,0 +1,32 @@
+#!/bin/sh
+# Throughput of the hex dumpers: hexdump, hd, xxd, od.
+#
+# Usage: dump.sh [BUSYBOX]...
+# BUSYBOX defaults to ../../busybox relative to this script.
+# Give two binaries (say, builds before and after a change)
+# to get their timings side by side.
+#
+# The input is $MB megabytes (default 16) of the tree's C sources
+# followed by as much of /dev/urandom, so that duplicate line folding
+# ("*") does not kick in.
+
+. "${0%/*}/lib.sh"
+bins=${*:-"$dir/../../busybox"}
+MB=${MB:-16}
+
+data=$(mktemp) || exit 1
+trap 'rm -f "$data"' EXIT
+
+make_sources "$data" $((MB * 1024 * 1024 / 2))
+head -c $((MB * 1024 * 1024 / 2)) /dev/urandom >>"$data"
+cat "$data" >/dev/null
+
+bins_header "$MB MB"
+time_bins hexdump    "$data" hexdump
+time_bins hexdump-C  "$data" hexdump -C
+time_bins hexdump-x  "$data" hexdump -x
+time_bins xxd        "$data" xxd
+time_bins xxd-g4     "$data" xxd -g4
+time_bins od         "$data" od
+time_bins od-tx1     "$data" od -tx1
+time_bins od-td4     "$data" od -td4
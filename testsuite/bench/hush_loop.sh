@@ -0,0 +1,21 @@
+#!/bin/sh
+# Microbenchmark for the hush interpreter loop.
+#
+# Usage: hush_loop.sh [SHELL [LOOPS]]
+# SHELL defaults to "../../busybox hush" relative to this script.
+#
+# Each case is a LOOPS-iteration (default 1000000) loop, run in a fresh
+# shell with an empty environment.
+
+. "${0%/*}/lib.sh"
+sh=${1:-"$dir/../../busybox hush"}
+loops=${2:-1000000}
+
+run()
+{
+	env -i $sh -c "$1"
+}
+
+time_one count run "i=0; while [ \$i -lt $loops ]; do i=\$((i+1)); done; echo \$i"
+time_one vars  run "i=0; a=x; while [ \$i -lt $loops ]; do b=\$a\$i; c=\"\$b-\$a\"; i=\$((i+1)); done; echo \$c"
+time_one func  run "f() { r=\$1; }; i=0; while [ \$i -lt $loops ]; do f \$i; i=\$((i+1)); done; echo \$r"
@@ -0,0 +1,66 @@
+# Common part of the benchmark scripts, sourced by them.
+#
+# Times are wall clock milliseconds: compare the numbers between builds.
+
+dir=${0%/*}
+
+ms()
+{
+	# %N is not POSIX, but both coreutils and busybox date support it
+	t=$(date +%s%N)
+	echo $((t / 1000000))
+}
+
+# time_one NAME COMMAND [ARGS]...
+# Time one run of COMMAND and print its output, for a sanity check
+time_one()
+{
+	name=$1
+	shift
+	t0=$(ms)
+	out=$("$@") || { echo "$name: FAILED"; exit 1; }
+	t1=$(ms)
+	printf '%-16s %8d ms  %s\n' "$name" $((t1 - t0)) "$out"
+}
+
+# Scripts comparing several busybox binaries set $bins to their list.
+# Input files should be read once before timing, to be in page cache.
+
+# make_sources FILE BYTES
+# Append the tree's C sources to FILE until it has at least BYTES
+make_sources()
+{
+	while [ $(wc -c <"$1") -lt $2 ]; do
+		cat "$dir"/../../*/*.c >>"$1"
+	done
+}
+
+# bins_header TITLE
+bins_header()
+{
+	printf '%-12s' "$1"
+	for bb in $bins; do printf ' %11s' "${bb##*/}"; done
+	echo
+}
+
+# time_bins NAME FILE APPLET [ARGS]...
+# Time APPLET <FILE >/dev/null for each of $bins, side by side.
+# A second, untimed run checksums the output to compare it
+time_bins()
+{
+	name=$1
+	file=$2
+	shift 2
+	printf '%-12s' "$name"
+	prev=
+	for bb in $bins; do
+		t0=$(ms)
+		$bb "$@" <"$file" >/dev/null || { echo " FAILED"; exit 1; }
+		t1=$(ms)
+		sum=$($bb "$@" <"$file" | md5sum)
+		printf ' %8d ms' $((t1 - t0))
+		[ -n "$prev" ] && [ "$prev" != "$sum" ] && printf ' (output differs)'
+		prev=$sum
+	done
+	echo
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Throughput of the block scanning applets: wc, tr, cut, uniq.
+#
+# Usage: textscan.sh [BUSYBOX]...
+# BUSYBOX defaults to ../../busybox relative to this script.
+# Give two binaries (say, builds before and after a change)
+# to get their timings side by side.
+#
+# The input is the tree's C sources concatenated until it is
+# $MB megabytes (default 64), and the same sorted for uniq.
+
+. "${0%/*}/lib.sh"
+bins=${*:-"$dir/../../busybox"}
+MB=${MB:-64}
+
+data=$(mktemp) || exit 1
+trap 'rm -f "$data" "$data.sorted"' EXIT
+
+make_sources "$data" $((MB * 1024 * 1024))
+LC_ALL=C sort "$data" >"$data.sorted"
+cat "$data" "$data.sorted" >/dev/null
+
+bins_header "$MB MB"
+time_bins wc-l       "$data"        wc -l
+time_bins wc         "$data"        wc
+time_bins wc-L       "$data"        wc -L
+time_bins tr-upcase  "$data"        tr a-z A-Z
+time_bins tr-rot13   "$data"        tr a-zA-Z n-za-mN-ZA-M
+time_bins cut-b      "$data"        cut -b 1-20
+time_bins cut-f      "$data"        cut -d '(' -f 2
+time_bins uniq       "$data.sorted" uniq
+time_bins uniq-c     "$data.sorted" uniq -c
@@ -0,0 +1 @@
+cmd_util-linux/built-in.o :=  rm -f util-linux/built-in.o; ar rcs util-linux/built-in.o
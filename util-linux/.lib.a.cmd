@@ -0,0 +1 @@
+cmd_util-linux/lib.a := rm -f util-linux/lib.a; ar  rcs util-linux/lib.a util-linux/acpid.o util-linux/blkdiscard.o util-linux/blkid.o util-linux/blockdev.o util-linux/cal.o util-linux/chrt.o util-linux/dmesg.o util-linux/eject.o util-linux/fallocate.o util-linux/fatattr.o util-linux/fbset.o util-linux/fdformat.o util-linux/fdisk.o util-linux/findfs.o util-linux/flock.o util-linux/freeramdisk.o util-linux/fsck_minix.o util-linux/fsfreeze.o util-linux/fstrim.o util-linux/getopt.o util-linux/hexdump.o util-linux/hexdump_xxd.o util-linux/hwclock.o util-linux/ionice.o util-linux/ipcrm.o util-linux/ipcs.o util-linux/last_fancy.o util-linux/losetup.o util-linux/lspci.o util-linux/lsusb.o util-linux/mdev.o util-linux/mesg.o util-linux/mkfs_ext2.o util-linux/mkfs_minix.o util-linux/mkfs_vfat.o util-linux/mkswap.o util-linux/more.o util-linux/mount.o util-linux/mountpoint.o util-linux/nsenter.o util-linux/pivot_root.o util-linux/rdate.o util-linux/rdev.o util-linux/readprofile.o util-linux/renice.o util-linux/rev.o util-linux/rtcwake.o util-linux/script.o util-linux/scriptreplay.o util-linux/setarch.o util-linux/setpriv.o util-linux/setsid.o util-linux/swaponoff.o util-linux/switch_root.o util-linux/taskset.o util-linux/uevent.o util-linux/umount.o util-linux/unshare.o util-linux/wall.o
@@ -0,0 +1 @@
+cmd_util-linux/volume_id/built-in.o :=  rm -f util-linux/volume_id/built-in.o; ar rcs util-linux/volume_id/built-in.o
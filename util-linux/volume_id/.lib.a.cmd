@@ -0,0 +1 @@
+cmd_util-linux/volume_id/lib.a := rm -f util-linux/volume_id/lib.a; ar  rcs util-linux/volume_id/lib.a util-linux/volume_id/bcache.o util-linux/volume_id/btrfs.o util-linux/volume_id/cramfs.o util-linux/volume_id/erofs.o util-linux/volume_id/exfat.o util-linux/volume_id/ext.o util-linux/volume_id/f2fs.o util-linux/volume_id/fat.o util-linux/volume_id/get_devname.o util-linux/volume_id/hfs.o util-linux/volume_id/iso9660.o util-linux/volume_id/jfs.o util-linux/volume_id/lfs.o util-linux/volume_id/linux_raid.o util-linux/volume_id/linux_swap.o util-linux/volume_id/luks.o util-linux/volume_id/minix.o util-linux/volume_id/nilfs.o util-linux/volume_id/ntfs.o util-linux/volume_id/ocfs2.o util-linux/volume_id/reiserfs.o util-linux/volume_id/romfs.o util-linux/volume_id/squashfs.o util-linux/volume_id/sysv.o util-linux/volume_id/ubifs.o util-linux/volume_id/udf.o util-linux/volume_id/util.o util-linux/volume_id/volume_id.o util-linux/volume_id/xfs.o